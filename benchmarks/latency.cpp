@@ -0,0 +1,221 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Latency Benchmarks
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <spsc.hpp>
+#include <oneshot.hpp>
+#include "tools/config.hpp"
+#include "tools/latency.hpp"
+
+using namespace channels;
+using channels::benchmarks::LatencyHistogram;
+using channels::benchmarks::now_ticks;
+using channels::benchmarks::ticks_per_ns;
+
+/// Number of messages measured by every configuration, can be overridden by the first argument
+constexpr size_t LATENCY_MESSAGES = 200000;
+
+/// Pause between one-way messages, so the latency is measured on an idle channel and not the time spent in a full queue
+constexpr uint64_t SEND_INTERVAL_NS = 2000;
+
+/// Messages skipped at the start of every run, they pay for page faults and cold caches
+constexpr size_t WARMUP_MESSAGES = 1000;
+
+/// @brief Message carrying its send timestamp, Size is its total size in bytes
+template <size_t Size>
+struct Message {
+    static_assert(Size > sizeof(uint64_t), "Message has to fit the timestamp");
+    uint64_t stamp;
+    char payload[Size - sizeof(uint64_t)];
+};
+
+constexpr const char* wait_name(WaitStrategy wait) {
+    switch (wait) {
+        case WaitStrategy::BUSY_LOOP: return "BUSY_LOOP";
+        case WaitStrategy::YIELD: return "YIELD";
+        case WaitStrategy::ATOMIC_WAIT: return "ATOMIC_WAIT";
+        case WaitStrategy::ADAPTIVE: return "ADAPTIVE";
+        case WaitStrategy::ASYNC: return "ASYNC";
+    }
+    return "";
+}
+
+constexpr const char* overflow_name(OverflowStrategy strategy) {
+    switch (strategy) {
+        case OverflowStrategy::WAIT_ON_FULL: return "WAIT_ON_FULL";
+        case OverflowStrategy::OVERWRITE_ON_FULL: return "OVERWRITE_ON_FULL";
+        case OverflowStrategy::OVERWRITE_SEQUENCED: return "OVERWRITE_SEQUENCED";
+    }
+    return "";
+}
+
+/// @brief Send timestamped messages at a fixed pace and record send-to-receive latency
+template <WaitStrategy Wait, OverflowStrategy Strategy, size_t Size>
+void test_one_way(size_t messages) {
+    auto [sender, receiver] = spsc::channel<Message<Size>, Strategy, Wait>(QUEUE_CAPACITY);
+    LatencyHistogram<> histogram;
+    const uint64_t interval = static_cast<uint64_t>(SEND_INTERVAL_NS * ticks_per_ns());
+
+    std::thread producer([&sender, messages, interval]() {
+        pin_thread(0);
+        Message<Size> message{};
+        uint64_t next = now_ticks();
+        for (size_t i = 0; i < WARMUP_MESSAGES + messages; i++) {
+            while (now_ticks() < next) {
+                cpu_relax();
+            }
+            message.stamp = now_ticks();
+            sender.send(message);
+            next = message.stamp + interval;
+        }
+        sender.close();
+    });
+    std::thread consumer([&receiver, &histogram]() {
+        pin_thread(1);
+        Message<Size> message{};
+        size_t received = 0;
+        while (receiver.receive(message) == ResponseStatus::SUCCESS) {
+            const uint64_t now = now_ticks();
+            if (received++ >= WARMUP_MESSAGES) {
+                histogram.record(now - message.stamp);
+            }
+        }
+    });
+    producer.join();
+    consumer.join();
+
+    channels::benchmarks::print_latency_row(std::string(wait_name(Wait)) + " " + overflow_name(Strategy) + " " + std::to_string(Size) + "B", histogram);
+}
+
+/// @brief Bounce a timestamped message between two threads over a pair of channels and record the round trip
+template <WaitStrategy Wait, size_t Size>
+void test_ping_pong(size_t messages) {
+    auto [ping_sender, ping_receiver] = spsc::channel<Message<Size>, OverflowStrategy::WAIT_ON_FULL, Wait>(QUEUE_CAPACITY);
+    auto [pong_sender, pong_receiver] = spsc::channel<Message<Size>, OverflowStrategy::WAIT_ON_FULL, Wait>(QUEUE_CAPACITY);
+    LatencyHistogram<> histogram;
+
+    std::thread echo([&ping_receiver, &pong_sender]() {
+        pin_thread(1);
+        Message<Size> message{};
+        while (ping_receiver.receive(message) == ResponseStatus::SUCCESS) {
+            pong_sender.send(message);
+        }
+    });
+    pin_thread(0);
+    Message<Size> message{};
+    for (size_t i = 0; i < WARMUP_MESSAGES + messages; i++) {
+        message.stamp = now_ticks();
+        ping_sender.send(message);
+        pong_receiver.receive(message);
+        if (i >= WARMUP_MESSAGES) {
+            histogram.record(now_ticks() - message.stamp);
+        }
+    }
+    ping_sender.close();
+    echo.join();
+
+    channels::benchmarks::print_latency_row(std::string(wait_name(Wait)) + " " + std::to_string(Size) + "B", histogram);
+}
+
+/// @brief Same round trip as the oneshot throughput benchmark, a fresh channel per message in both directions
+template <WaitStrategy Wait>
+void test_oneshot_ping_pong(size_t messages) {
+    using Reply = oneshot::Sender<uint64_t, Wait>;
+    auto [request_sender, request_receiver] = spsc::channel<Reply, OverflowStrategy::WAIT_ON_FULL, Wait>(QUEUE_CAPACITY);
+    LatencyHistogram<> histogram;
+
+    std::thread echo([&request_receiver]() {
+        pin_thread(1);
+        Reply reply;
+        while (request_receiver.receive(reply) == ResponseStatus::SUCCESS) {
+            reply.send(now_ticks());
+        }
+    });
+    pin_thread(0);
+    for (size_t i = 0; i < WARMUP_MESSAGES + messages; i++) {
+        const uint64_t start = now_ticks();
+        auto [reply_sender, reply_receiver] = oneshot::channel<uint64_t, Wait>();
+        request_sender.send(std::move(reply_sender));
+        reply_receiver.receive();
+        if (i >= WARMUP_MESSAGES) {
+            histogram.record(now_ticks() - start);
+        }
+    }
+    request_sender.close();
+    echo.join();
+
+    channels::benchmarks::print_latency_row(wait_name(Wait), histogram);
+}
+
+template <WaitStrategy Wait, OverflowStrategy Strategy>
+void test_one_way_sizes(size_t messages) {
+    test_one_way<Wait, Strategy, 16>(messages);
+    test_one_way<Wait, Strategy, 64>(messages);
+    test_one_way<Wait, Strategy, 512>(messages);
+}
+
+template <WaitStrategy Wait>
+void test_wait_strategy(size_t messages) {
+    test_one_way_sizes<Wait, OverflowStrategy::WAIT_ON_FULL>(messages);
+    test_one_way_sizes<Wait, OverflowStrategy::OVERWRITE_ON_FULL>(messages);
+    test_one_way_sizes<Wait, OverflowStrategy::OVERWRITE_SEQUENCED>(messages);
+}
+
+template <WaitStrategy Wait>
+void test_ping_pong_sizes(size_t messages) {
+    test_ping_pong<Wait, 16>(messages);
+    test_ping_pong<Wait, 64>(messages);
+    test_ping_pong<Wait, 512>(messages);
+}
+
+int main(int argc, char** argv) {
+    const size_t messages = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : LATENCY_MESSAGES;
+    std::cout << "Messages per run: " << messages << ", ticks per ns: " << ticks_per_ns() << "\n";
+
+    std::cout << "\n=== SPSC one-way latency (one message every " << SEND_INTERVAL_NS << " ns) ===\n";
+    channels::benchmarks::print_latency_header("Configuration");
+    test_wait_strategy<WaitStrategy::BUSY_LOOP>(messages);
+    test_wait_strategy<WaitStrategy::YIELD>(messages);
+    test_wait_strategy<WaitStrategy::ATOMIC_WAIT>(messages);
+    test_wait_strategy<WaitStrategy::ADAPTIVE>(messages);
+
+    std::cout << "\n=== SPSC ping-pong round trip ===\n";
+    channels::benchmarks::print_latency_header("Configuration");
+    test_ping_pong_sizes<WaitStrategy::BUSY_LOOP>(messages);
+    test_ping_pong_sizes<WaitStrategy::YIELD>(messages);
+    test_ping_pong_sizes<WaitStrategy::ATOMIC_WAIT>(messages);
+    test_ping_pong_sizes<WaitStrategy::ADAPTIVE>(messages);
+
+    std::cout << "\n=== Oneshot round trip (new channel per message) ===\n";
+    channels::benchmarks::print_latency_header("Wait strategy");
+    test_oneshot_ping_pong<WaitStrategy::BUSY_LOOP>(messages);
+    test_oneshot_ping_pong<WaitStrategy::YIELD>(messages);
+    test_oneshot_ping_pong<WaitStrategy::ATOMIC_WAIT>(messages);
+    test_oneshot_ping_pong<WaitStrategy::ADAPTIVE>(messages);
+
+    return 0;
+}
@@ -0,0 +1,43 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * MPMC Channel Contention Benchmarks
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "tools/harness.hpp"
+#include "tools/adapters.hpp"
+
+using namespace channels::benchmarks;
+
+/// Equal number of producers and consumers, the mutex queue is the usual fallback when no lock-free MPMC queue is available
+int main(int argc, char** argv) {
+    std::ios_base::sync_with_stdio(false);
+    const Options options = parse_options(argc, argv);
+    Reporter reporter(options);
+
+    Sweep sweep;
+    sweep.threads = { { 2, 2 }, { 4, 4 }, { 8, 8 } };
+    run_sweep<MpmcQueue>(options, sweep, reporter);
+    run_sweep<MutexQueue>(options, sweep, reporter);
+
+    return 0;
+}
@@ -110,13 +110,24 @@ void operator delete(void*, size_t) noexcept {}
 void operator delete[](void*, size_t) noexcept {}
 #endif
 
+/// @brief Message whose channels are allocated from channels::arc_pool (the default for oneshot)
 struct TestMsg {
     int value;
     Sender<TestMsg> sender;
 };
 
+/// @brief Message whose channels bypass the pool and go through operator new / delete
+struct HeapMsg {
+    int value;
+    Sender<HeapMsg> sender;
+};
+
+template <>
+struct channels::arc_pooled<InnerChannel<HeapMsg, channels::WaitStrategy::BUSY_LOOP>> : std::false_type {};
+
+template <typename Msg>
 void test_send_rcv_loop(double duration_seconds) {
-    auto [sender, receiver] = channel<TestMsg>();
+    auto [sender, receiver] = channel<Msg>();
     std::atomic<bool> running{ true };
     int sentFromT1 = 0;
     int sentFromT2 = 0;
@@ -124,28 +135,47 @@ void test_send_rcv_loop(double duration_seconds) {
     int receivedInT2 = 0;
     auto start_time = std::chrono::high_resolution_clock::now();
     std::clock_t cpu_start = std::clock();
+
+    // the peer may stop in the middle of the ping-pong, so waiting has to observe the running flag
+    auto receive_while_running = [&running](Receiver<Msg>& rx, Msg& msg) {
+        while (rx.try_receive(msg) != channels::ResponseStatus::SUCCESS) {
+            if (!running.load(std::memory_order_relaxed)) {
+                return false;
+            }
+        }
+        return true;
+    };
     
     std::thread t1([&]() {
         auto t2_sender = std::move(sender);
         while (running.load(std::memory_order_relaxed)) {
-            auto [tmp_sender, tmp_receiver] = channel<TestMsg>();
-            t2_sender.send(TestMsg{ 57, std::move(tmp_sender) });
+            auto [tmp_sender, tmp_receiver] = channel<Msg>();
+            t2_sender.send(Msg{ 57, std::move(tmp_sender) });
             sentFromT1++;
-            auto rcvd = tmp_receiver.receive();
+            Msg rcvd;
+            if (!receive_while_running(tmp_receiver, rcvd)) {
+                break;
+            }
             t2_sender = std::move(rcvd.sender);
             receivedInT1++;
         }
     });
     
     std::thread t2([&]() {
-        Sender<TestMsg> t2_sender;
-        auto rcvd = receiver.receive();
-        t2_sender = std::move(rcvd.sender);
+        Sender<Msg> t2_sender;
+        Msg first;
+        if (!receive_while_running(receiver, first)) {
+            return;
+        }
+        t2_sender = std::move(first.sender);
         while (running.load(std::memory_order_relaxed)) {
-            auto [tmp_sender, tmp_receiver] = channel<TestMsg>();
-            t2_sender.send(TestMsg{ 57, std::move(tmp_sender) });
+            auto [tmp_sender, tmp_receiver] = channel<Msg>();
+            t2_sender.send(Msg{ 57, std::move(tmp_sender) });
             sentFromT2++;
-            auto rcvd = tmp_receiver.receive();
+            Msg rcvd;
+            if (!receive_while_running(tmp_receiver, rcvd)) {
+                break;
+            }
             t2_sender = std::move(rcvd.sender);
             receivedInT2++;
         }
@@ -153,6 +183,8 @@ void test_send_rcv_loop(double duration_seconds) {
     
     std::this_thread::sleep_for(std::chrono::duration<double>(duration_seconds));
     running.store(false, std::memory_order_relaxed);
+    t1.join();
+    t2.join();
     
     std::clock_t cpu_end = std::clock();
     auto end_time = std::chrono::high_resolution_clock::now();
@@ -172,17 +204,93 @@ void test_send_rcv_loop(double duration_seconds) {
     #endif
 }
 
+/// @brief Same ping-pong, but every thread keeps one receiver and rearms it with reset() after each message
+/// No channel is allocated inside the loop, so it measures the synchronization cost alone
+void test_send_rcv_reuse_loop(double duration_seconds) {
+    auto [sender1, receiver1] = channel<TestMsg>();
+    auto [sender2, receiver2] = channel<TestMsg>();
+    std::atomic<bool> running{ true };
+    int sentFromT1 = 0;
+    int sentFromT2 = 0;
+    int receivedInT1 = 0;
+    int receivedInT2 = 0;
+    auto start_time = std::chrono::high_resolution_clock::now();
+    std::clock_t cpu_start = std::clock();
+
+    auto receive_while_running = [&running](Receiver<TestMsg>& rx, TestMsg& msg) {
+        while (rx.try_receive(msg) != channels::ResponseStatus::SUCCESS) {
+            if (!running.load(std::memory_order_relaxed)) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    std::thread t1([&]() {
+        Sender<TestMsg> peer = std::move(sender2);
+        Sender<TestMsg> reply = std::move(sender1);
+        while (running.load(std::memory_order_relaxed)) {
+            peer.send(TestMsg{ 57, std::move(reply) });
+            sentFromT1++;
+            TestMsg rcvd;
+            if (!receive_while_running(receiver1, rcvd)) {
+                break;
+            }
+            peer = std::move(rcvd.sender);
+            reply = receiver1.reset();
+            receivedInT1++;
+        }
+    });
+
+    std::thread t2([&]() {
+        while (running.load(std::memory_order_relaxed)) {
+            TestMsg rcvd;
+            if (!receive_while_running(receiver2, rcvd)) {
+                break;
+            }
+            Sender<TestMsg> peer = std::move(rcvd.sender);
+            receivedInT2++;
+            peer.send(TestMsg{ 57, receiver2.reset() });
+            sentFromT2++;
+        }
+    });
+
+    std::this_thread::sleep_for(std::chrono::duration<double>(duration_seconds));
+    running.store(false, std::memory_order_relaxed);
+    t1.join();
+    t2.join();
+
+    std::clock_t cpu_end = std::clock();
+    auto end_time = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> elapsed = end_time - start_time;
+    double cpu_time = static_cast<double>(cpu_end - cpu_start) / CLOCKS_PER_SEC;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Thread 1 sent: " << sentFromT1 << ", received: " << receivedInT1 << "\n";
+    std::cout << "Thread 2 sent: " << sentFromT2 << ", received: " << receivedInT2 << "\n";
+    std::cout << "Elapsed time: " << elapsed.count() << " seconds\n";
+    std::cout << "CPU time: " << cpu_time << " seconds\n";
+    std::cout << "CPU usage: " << (cpu_time / elapsed.count()) * 100 << "%\n";
+    std::cout << "Throughput (messages/sec): " << (sentFromT1 + sentFromT2) / elapsed.count() << "\n";
+}
+
 int main() {
 
-    /// Oneshot channel at the time of performing that benchmark is using new operator
-    /// It is used almost all the time in this test because we create and delete oneshot channels
-    /// So to better test actuall performance of the channel we can run shorter test with very simple and efficient allocation
+    /// Allocation dominates this test because every message creates and destroys a oneshot channel
+    /// Heap channels show the cost of the system allocator, pooled channels recycle their blocks
+    /// The bump allocator never frees, so it gives an upper bound for allocation speed but can run only for a short time
     #if USE_CUSTOM_ALLOCATOR
         std::cout << "\n=== Testing with bump allocator ===\n";
-        test_send_rcv_loop(0.5);
+        test_send_rcv_loop<HeapMsg>(0.5);
+        std::cout << "\n=== Testing with pool allocator (slabs from bump allocator) ===\n";
+        test_send_rcv_loop<TestMsg>(0.5);
     #else
         std::cout << "\n=== Testing with system allocator ===\n";
-        test_send_rcv_loop(5);
+        test_send_rcv_loop<HeapMsg>(5);
+        std::cout << "\n=== Testing with pool allocator ===\n";
+        test_send_rcv_loop<TestMsg>(5);
     #endif
+    std::cout << "\n=== Testing with reused channels ===\n";
+    test_send_rcv_reuse_loop(USE_CUSTOM_ALLOCATOR ? 0.5 : 5);
     return 0;
 }
\ No newline at end of file
@@ -23,228 +23,38 @@
  * SOFTWARE.
  */
 
-#include <thread>
-#include <chrono>
-#include <iostream>
-#include <iomanip>
-#include "tools/spsc_benchmarks.hpp"
-#include "tools/config.hpp"
+#include "tools/harness.hpp"
+#include "tools/adapters.hpp"
 
-using namespace channels::spsc::benchmarks;
+using namespace channels::benchmarks;
 
-void warmup() {
-    auto [sender, receiver] = channel<int>(QUEUE_CAPACITY);
-    // auto sender = std::move(channel_.first);
-    // auto receiver = std::move(channel_.second);
-
-    std::thread producer([&sender]() {
-        for (int i = 0; i < 10000; ++i) {
-            sender.send(i);
-        }
-    });
-    std::thread consumer([&receiver]() {
-        int value;
-        for (int i = 0; i < 10000; ++i) {
-            receiver.receive();
-        }
-    });
-    producer.join();
-    consumer.join();
-}
-
-long double test_throughput_default(double duration_seconds, bool print_results) {
-    auto [sender, receiver] = channel<int>(QUEUE_CAPACITY);
-
-    // Measure throughput
-    auto start = std::chrono::high_resolution_clock::now();
-
-    std::atomic<bool> running{true};
-
-    int produced = 0;
-    int consumed = 0;
-
-    std::thread producer([&sender, &produced, &running]() {
-        while (running.load(std::memory_order_relaxed)) {
-            sender.send(produced);
-            produced++;
-        }
-    });
-    std::thread consumer([&receiver, &consumed, &running]() {
-        while (running.load(std::memory_order_relaxed)) {
-            receiver.receive();
-            consumed++;
-        }
-    });
-
-    /// sleep for specified duration
-    std::this_thread::sleep_for(std::chrono::duration<double>(duration_seconds));
-
-    running.store(false, std::memory_order_relaxed);
-    producer.join();
-    sender.try_send(0); // Make sure that consumer can exit
-    consumer.join();
-
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> actual_duration = end - start;
-    long double throughput = static_cast<long double>(produced + consumed) / actual_duration.count();
-    
-    if (print_results) {
-        std::cout << "Produced: " << produced << ", Consumed: " << consumed << "\n";
-        std::cout << "Duration: " << actual_duration.count() << " seconds\n";
-        std::cout << "Throughput (default): " << std::fixed << std::setprecision(0) << throughput << " ops/sec\n";
-    }
-    
-    return throughput;
-}
-
-long double test_throughput_pinning(double duration_seconds, bool print_results) {
-    auto [sender, receiver] = channel<int>(QUEUE_CAPACITY);
-
-    // Measure throughput
-    auto start = std::chrono::high_resolution_clock::now();
-    std::atomic<bool> running{true};
-
-    int produced = 0;
-    int consumed = 0;
-
-    std::thread producer([&sender, &produced, &running]() {
-        pin_thread(0);
-        while (running.load(std::memory_order_relaxed)) {
-            sender.send(produced);
-            produced++;
-        }
-    });
-    std::thread consumer([&receiver, &consumed, &running]() {
-        pin_thread(1);
-        while (running.load(std::memory_order_relaxed)) {
-            receiver.receive();
-            consumed++;
-        }
-    });
-
-    /// sleep for specified duration
-    std::this_thread::sleep_for(std::chrono::duration<double>(duration_seconds));
-
-    running.store(false, std::memory_order_relaxed);
-    producer.join();
-    sender.try_send(0); // Make sure that consumer can exit
-    consumer.join();
-
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> actual_duration = end - start;
-    long double throughput = static_cast<long double>(produced + consumed) / actual_duration.count();
-    
-    if (print_results) {
-        std::cout << "Produced: " << produced << ", Consumed: " << consumed << "\n";
-        std::cout << "Duration: " << actual_duration.count() << " seconds\n";
-        std::cout << "Throughput (high priority): " << std::fixed << std::setprecision(0) << throughput << " ops/sec\n";
-    }
-    
-    return throughput;
-}
-
-long double test_latency_default(bool print_results) {
-    auto [sender, receiver] = channel<int>(QUEUE_CAPACITY);
-
-    // Measure throughput
-    auto start = std::chrono::high_resolution_clock::now();
-
-    std::thread producer([&sender]() {
-        for (int i = 0; i < SPEED_TEST_QUANTITY; ++i) {
-            sender.send(i);
-        }
-    });
-    std::thread consumer([&receiver]() {
-        for (int i = 0; i < SPEED_TEST_QUANTITY; ++i) {
-            int value = receiver.receive();
-        }
-    });
-    producer.join();
-    consumer.join();
-
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> duration = end - start;
-    long double throughput = static_cast<long double>(SPEED_TEST_QUANTITY + SPEED_TEST_QUANTITY) / duration.count();
-    
-    if (print_results) {
-        std::cout << "Produced: " << SPEED_TEST_QUANTITY << ", Consumed: " << SPEED_TEST_QUANTITY << "\n";
-        std::cout << "Duration: " << duration.count() << " seconds\n";
-        std::cout << "Throughput: " << std::fixed << std::setprecision(0) << throughput << " ops/sec\n";
-    }
-    
-    return throughput;
-}
-
-long double test_latency_pinned(bool print_results) {
-    auto [sender, receiver] = channel<int>(QUEUE_CAPACITY);
-
-    // Measure throughput
-    auto start = std::chrono::high_resolution_clock::now();
-
-    std::thread producer([&sender]() {
-        pin_thread(0);
-        for (int i = 0; i < SPEED_TEST_QUANTITY; ++i) {
-            sender.send(i);
-        }
-    });
-    std::thread consumer([&receiver]() {
-        pin_thread(1);
-        for (int i = 0; i < SPEED_TEST_QUANTITY; ++i) {
-            int value = receiver.receive();
-        }
-    });
-    producer.join(); 
-    consumer.join();
-
-    auto end = std::chrono::high_resolution_clock::now();
-    std::chrono::duration<double> duration = end - start;
-    long double throughput = static_cast<long double>(SPEED_TEST_QUANTITY + SPEED_TEST_QUANTITY) / duration.count();
-    
-    if (print_results) {
-        std::cout << "Produced: " << SPEED_TEST_QUANTITY << ", Consumed: " << SPEED_TEST_QUANTITY << "\n";
-        std::cout << "Duration: " << duration.count() << " seconds\n";
-        std::cout << "Throughput (high priority): " << std::fixed << std::setprecision(0) << throughput << " ops/sec\n";
-    }
-    
-    return throughput;
-}
-
-int main() {
+int main(int argc, char** argv) {
     std::ios_base::sync_with_stdio(false);
-    std::cin.tie(nullptr);
-    std::cout.tie(nullptr);
-
-
-    for (int i = 0; i < AVERAGE_EPOCHS * 10; i++) {
-        warmup();
-    }
-
-    std::cout << std::fixed << std::setprecision(0);
-    std::cout << "SPSC benchmarks: \n";
-    double throughput = 0.0;
-    for (int i = 0; i < AVERAGE_EPOCHS; i++) {
-        throughput += test_throughput_default(5.0, false);
-    }
-    std::cout << "Throughput (default): " << throughput / AVERAGE_EPOCHS << " ops/sec\n";
+    const Options options = parse_options(argc, argv);
+    Reporter reporter(options);
+
+    // Frozen benchmark copy, the numbers behind the README tables, on every thread placement
+    Sweep placements;
+    placements.placements = { Placement::NONE, Placement::SAME_CORE, Placement::SMT_SIBLING, Placement::CROSS_CORE, Placement::CROSS_SOCKET };
+    run_sweep<SpscBenchmarkQueue>(options, placements, reporter);
+
+    // Batch operations are not part of the benchmark copy
+    Sweep batches;
+    batches.batches = { 1, 8, 64, 512 };
+    run_sweep<SpscQueue>(options, batches, reporter);
+
+    // Big channels, where TLB misses and page faults start to matter
+    Sweep storage;
+    storage.capacities = { QUEUE_CAPACITY, LARGE_QUEUE_CAPACITY, HUGE_QUEUE_CAPACITY };
+    run_sweep<SpscQueue>(options, storage, reporter);
+    run_sweep<SpscHugePageQueue>(options, storage, reporter);
+
+    // Ring placement across sockets, first touch by the main thread against the consumer NUMA node
+    Sweep nodes;
+    nodes.capacities = { LARGE_QUEUE_CAPACITY };
+    nodes.placements = { Placement::SMT_SIBLING, Placement::CROSS_CORE, Placement::CROSS_SOCKET };
+    run_sweep<SpscHugePageQueue>(options, nodes, reporter);
+    run_sweep<SpscConsumerNodeQueue>(options, nodes, reporter);
 
-    throughput = 0.0;
-    for (int i = 0; i < AVERAGE_EPOCHS; i++) {
-        throughput += test_throughput_pinning(5.0, false);
-    }
-    std::cout << "Throughput (pinned): " << throughput / AVERAGE_EPOCHS << " ops/sec\n";
-
-    throughput = 0.0;
-    for (int i = 0; i < AVERAGE_EPOCHS; i++) {
-        throughput += test_latency_default(false);
-    }
-    std::cout << "Latency (default): " << throughput / AVERAGE_EPOCHS << " ops/sec\n";
-
-    throughput = 0.0;
-    for (int i = 0; i < AVERAGE_EPOCHS; i++) {
-        throughput += test_latency_pinned(false);
-    }
-    std::cout << "Latency (pinned): " << throughput / AVERAGE_EPOCHS << " ops/sec\n";
-
-    std::cout.flush();
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,308 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Benchmark Queue Adapters
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// Adapters plugging queues into the harness (see queue_adapter in harness.hpp)
+
+#include <memory>
+#include <utility>
+#include <spsc.hpp>
+#include <mpsc.hpp>
+#include <mpmc.hpp>
+#include <mmap_allocator.hpp>
+#include <topology.hpp>
+#include "spsc_benchmarks.hpp"
+#include "spsc_mutex_benchmarks.hpp"
+
+#if __has_include(<boost/lockfree/spsc_queue.hpp>)
+#include <boost/lockfree/spsc_queue.hpp>
+#define CHANNELS_BENCHMARK_BOOST 1
+#endif
+
+namespace channels::benchmarks {
+
+/// @brief Library SPSC channel, batch sizes above 1 use try_send_n/try_receive_n
+template <typename T, typename Allocator = std::allocator<T>>
+struct SpscQueue {
+    using value_type = T;
+    static constexpr const char* name = "spsc";
+    static constexpr bool multi_producer = false;
+    static constexpr bool multi_consumer = false;
+
+    using Channel = decltype(channels::spsc::channel<T, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::BUSY_LOOP, Allocator>(0));
+
+    explicit SpscQueue(size_t capacity, const Allocator& alloc = Allocator()) : channel_(channels::spsc::channel<T, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::BUSY_LOOP, Allocator>(capacity, alloc)) {}
+
+    struct Producer {
+        typename Channel::first_type sender_;
+
+        inline bool try_send(const T& value) {
+            return sender_.try_send(value) == ResponseStatus::SUCCESS;
+        }
+
+        inline size_t try_send_n(const T* values, size_t n) {
+            return sender_.try_send_n(values, values + n);
+        }
+    };
+
+    struct Consumer {
+        typename Channel::second_type receiver_;
+
+        inline bool try_receive(T& value) {
+            return receiver_.try_receive(value) == ResponseStatus::SUCCESS;
+        }
+
+        inline size_t try_receive_n(T* values, size_t n) {
+            return receiver_.try_receive_n(values, n);
+        }
+    };
+
+    /// Handles are moved out, so each of them can be taken only once
+    inline Producer producer() {
+        return Producer{ std::move(channel_.first) };
+    }
+
+    inline Consumer consumer() {
+        return Consumer{ std::move(channel_.second) };
+    }
+
+    Channel channel_;
+};
+
+/// @brief Library SPSC channel with the ring on huge pages (mmap_allocator)
+template <typename T>
+struct SpscHugePageQueue : SpscQueue<T, channels::mmap_allocator<T>> {
+    static constexpr const char* name = "spsc-huge-pages";
+    using SpscQueue<T, channels::mmap_allocator<T>>::SpscQueue;
+};
+
+/// @brief Library SPSC channel with the ring on huge pages of the consumer NUMA node
+/// Unpinned runs leave the ring to first touch, like spsc-huge-pages.
+template <typename T>
+struct SpscConsumerNodeQueue : SpscQueue<T, channels::mmap_allocator<T>> {
+    static constexpr const char* name = "spsc-consumer-node";
+
+    explicit SpscConsumerNodeQueue(size_t capacity) : SpscQueue<T, channels::mmap_allocator<T>>(capacity) {}
+
+    SpscConsumerNodeQueue(size_t capacity, const ThreadPlacement& placement)
+        : SpscQueue<T, channels::mmap_allocator<T>>(capacity, channels::mmap_allocator<T>(channels::MmapOptions{
+              .numa_node = placement.pinned ? channels::topology::numa_node_of(placement.consumer_cpu) : -1 })) {}
+};
+
+/// @brief Frozen copy of the SPSC channel from spsc_benchmarks.hpp, the one behind the README tables
+template <typename T>
+struct SpscBenchmarkQueue {
+    using value_type = T;
+    static constexpr const char* name = "spsc-benchmark";
+    static constexpr bool multi_producer = false;
+    static constexpr bool multi_consumer = false;
+
+    using Channel = decltype(channels::spsc::benchmarks::channel<T>(0));
+
+    explicit SpscBenchmarkQueue(size_t capacity) : channel_(channels::spsc::benchmarks::channel<T>(capacity)) {}
+
+    struct Producer {
+        typename Channel::first_type sender_;
+
+        inline bool try_send(const T& value) {
+            return sender_.try_send(value);
+        }
+    };
+
+    struct Consumer {
+        typename Channel::second_type receiver_;
+
+        inline bool try_receive(T& value) {
+            return receiver_.try_receive(value);
+        }
+    };
+
+    inline Producer producer() {
+        return Producer{ std::move(channel_.first) };
+    }
+
+    inline Consumer consumer() {
+        return Consumer{ std::move(channel_.second) };
+    }
+
+    Channel channel_;
+};
+
+/// @brief Library MPSC channel, every producer gets its own copy of the sender
+template <typename T>
+struct MpscQueue {
+    using value_type = T;
+    static constexpr const char* name = "mpsc";
+    static constexpr bool multi_producer = true;
+    static constexpr bool multi_consumer = false;
+
+    using Channel = decltype(channels::mpsc::channel<T>(0));
+
+    explicit MpscQueue(size_t capacity) : channel_(channels::mpsc::channel<T>(capacity)) {}
+
+    struct Producer {
+        typename Channel::first_type sender_;
+
+        inline bool try_send(const T& value) {
+            return sender_.try_send(value) == ResponseStatus::SUCCESS;
+        }
+    };
+
+    struct Consumer {
+        typename Channel::second_type receiver_;
+
+        inline bool try_receive(T& value) {
+            return receiver_.try_receive(value) == ResponseStatus::SUCCESS;
+        }
+    };
+
+    inline Producer producer() {
+        return Producer{ channel_.first };
+    }
+
+    inline Consumer consumer() {
+        return Consumer{ std::move(channel_.second) };
+    }
+
+    Channel channel_;
+};
+
+/// @brief Library MPMC channel, every thread gets its own copy of the handle
+template <typename T>
+struct MpmcQueue {
+    using value_type = T;
+    static constexpr const char* name = "mpmc";
+    static constexpr bool multi_producer = true;
+    static constexpr bool multi_consumer = true;
+
+    using Channel = decltype(channels::mpmc::channel<T>(0));
+
+    explicit MpmcQueue(size_t capacity) : channel_(channels::mpmc::channel<T>(capacity)) {}
+
+    struct Producer {
+        typename Channel::first_type sender_;
+
+        inline bool try_send(const T& value) {
+            return sender_.try_send(value) == ResponseStatus::SUCCESS;
+        }
+    };
+
+    struct Consumer {
+        typename Channel::second_type receiver_;
+
+        inline bool try_receive(T& value) {
+            return receiver_.try_receive(value) == ResponseStatus::SUCCESS;
+        }
+    };
+
+    inline Producer producer() {
+        return Producer{ channel_.first };
+    }
+
+    inline Consumer consumer() {
+        return Consumer{ channel_.second };
+    }
+
+    Channel channel_;
+};
+
+/// @brief Mutex protected ring, safe to be used by many threads so it serves as a baseline for everything
+template <typename T>
+struct MutexQueue {
+    using value_type = T;
+    static constexpr const char* name = "mutex";
+    static constexpr bool multi_producer = true;
+    static constexpr bool multi_consumer = true;
+
+    explicit MutexQueue(size_t capacity) : queue_(capacity) {}
+
+    struct Handle {
+        channels::spsc::benchmarks::spsc_mutex<T>* queue_;
+
+        inline bool try_send(const T& value) {
+            return queue_->write(value);
+        }
+
+        inline bool try_receive(T& value) {
+            return queue_->read(value);
+        }
+    };
+
+    inline Handle producer() {
+        return Handle{ &queue_ };
+    }
+
+    inline Handle consumer() {
+        return Handle{ &queue_ };
+    }
+
+    channels::spsc::benchmarks::spsc_mutex<T> queue_;
+};
+
+#ifdef CHANNELS_BENCHMARK_BOOST
+
+/// @brief boost::lockfree::spsc_queue, its array push/pop serve as the batch operations
+template <typename T>
+struct BoostQueue {
+    using value_type = T;
+    static constexpr const char* name = "boost";
+    static constexpr bool multi_producer = false;
+    static constexpr bool multi_consumer = false;
+
+    explicit BoostQueue(size_t capacity) : queue_(capacity) {}
+
+    struct Handle {
+        boost::lockfree::spsc_queue<T>* queue_;
+
+        inline bool try_send(const T& value) {
+            return queue_->push(value);
+        }
+
+        inline size_t try_send_n(const T* values, size_t n) {
+            return queue_->push(values, n);
+        }
+
+        inline bool try_receive(T& value) {
+            return queue_->pop(value);
+        }
+
+        inline size_t try_receive_n(T* values, size_t n) {
+            return queue_->pop(values, n);
+        }
+    };
+
+    inline Handle producer() {
+        return Handle{ &queue_ };
+    }
+
+    inline Handle consumer() {
+        return Handle{ &queue_ };
+    }
+
+    boost::lockfree::spsc_queue<T> queue_;
+};
+
+#endif
+
+}
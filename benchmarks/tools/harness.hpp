@@ -0,0 +1,502 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Benchmark Harness
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// Shared throughput harness, every queue is plugged in through a small adapter (see adapters.hpp)
+/// and measured over the same sweep of payload sizes, capacities, thread placements and batch sizes.
+/// Results are printed as CSV or JSON so they can be diffed between runs.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <concepts>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "config.hpp"
+#include "perf.hpp"
+
+namespace channels::benchmarks {
+
+/// Rings bigger than that are skipped, 4 KB payloads in a 16M slot ring would need 64 GB
+constexpr size_t MAX_RING_BYTES = 256 * 1024 * 1024;
+
+/// Messages sent before every measured configuration, they pay for page faults and cold caches
+constexpr size_t WARMUP_QUANTITY = 10000;
+
+/// @brief Message of exactly Size bytes, Payload<4> is the int used by the old benchmarks
+template <size_t Size>
+struct Payload {
+    unsigned char bytes[Size];
+};
+
+/// @brief Queue under test, constructed from a capacity and handing out producer and consumer handles
+/// Every thread asks for its own handle, so only adapters marked multi_producer/multi_consumer are asked more than once.
+/// Handles report success with a bool and never block, so no thread can get stuck after the other side is gone.
+template <typename Q>
+concept queue_adapter = std::constructible_from<Q, size_t> && requires(Q& queue, typename Q::value_type& value) {
+    { Q::name } -> std::convertible_to<std::string_view>;
+    { Q::multi_producer } -> std::convertible_to<bool>;
+    { Q::multi_consumer } -> std::convertible_to<bool>;
+    { queue.producer().try_send(value) } -> std::same_as<bool>;
+    { queue.consumer().try_receive(value) } -> std::same_as<bool>;
+};
+
+/// @brief Producer handle with a native batch operation, returns how many values were sent
+template <typename P, typename T>
+concept batch_producer = requires(P& producer, const T* values, size_t n) {
+    { producer.try_send_n(values, n) } -> std::same_as<size_t>;
+};
+
+/// @brief Consumer handle with a native batch operation, returns how many values were received
+template <typename C, typename T>
+concept batch_consumer = requires(C& consumer, T* values, size_t n) {
+    { consumer.try_receive_n(values, n) } -> std::same_as<size_t>;
+};
+
+/// @brief Where producer and consumer threads run
+enum class Placement {
+    NONE,           // not pinned, scheduler decides
+    SAME_CORE,      // both on the same logical CPU
+    SMT_SIBLING,    // two hardware threads of one physical core
+    CROSS_CORE,     // different physical cores of one socket
+    CROSS_SOCKET,   // different sockets
+};
+
+constexpr const char* placement_name(Placement placement) {
+    switch (placement) {
+        case Placement::NONE: return "none";
+        case Placement::SAME_CORE: return "same-core";
+        case Placement::SMT_SIBLING: return "smt-sibling";
+        case Placement::CROSS_CORE: return "cross-core";
+        case Placement::CROSS_SOCKET: return "cross-socket";
+    }
+    return "";
+}
+
+/// @brief CPUs resolved for a placement, pinned is false for Placement::NONE
+struct ThreadPlacement {
+    bool pinned;
+    size_t producer_cpu;
+    size_t consumer_cpu;
+};
+
+/// @brief Find CPUs for a placement from the topology, producer always runs on CPU 0
+/// @return nullopt if this machine has no such pair of CPUs
+inline std::optional<ThreadPlacement> resolve_placement(Placement placement) {
+    using channels::topology::CpuRelation;
+    if (placement == Placement::NONE) {
+        return ThreadPlacement{ false, 0, 0 };
+    }
+    if (placement == Placement::SAME_CORE) {
+        return ThreadPlacement{ true, 0, 0 };
+    }
+    if (!channels::topology::cpu_topology(0)) {
+        // no topology (pin_thread on macOS only raises priority), any second CPU is the best guess for a cross core run
+        if (placement == Placement::CROSS_CORE && std::thread::hardware_concurrency() > 1) {
+            return ThreadPlacement{ true, 0, 1 };
+        }
+        return std::nullopt;
+    }
+    const CpuRelation relation = placement == Placement::SMT_SIBLING ? CpuRelation::SMT_SIBLING
+                               : placement == Placement::CROSS_CORE ? CpuRelation::SAME_PACKAGE
+                               : CpuRelation::OTHER_PACKAGE;
+    if (const auto cpu = channels::topology::find_cpu(0, relation)) {
+        return ThreadPlacement{ true, 0, *cpu };
+    }
+    return std::nullopt;
+}
+
+enum class Format {
+    CSV,
+    JSON,
+};
+
+/// @brief Command line options shared by every harness based benchmark
+struct Options {
+    Format format = Format::CSV;
+    double duration = 5.0;          // seconds per timed run
+    size_t epochs = AVERAGE_EPOCHS; // runs averaged per configuration
+    size_t messages = 0;            // if not 0 every run sends this many messages instead of running for duration
+    bool counters = false;          // wrap every run in perf counters, see perf.hpp
+    uint64_t hitm_event = 0;        // raw event counted as HITM, 0 picks default_hitm_event()
+};
+
+inline void print_usage(const char* program) {
+    std::cerr << "Usage: " << program << " [--csv | --json] [--duration=<seconds>] [--epochs=<n>] [--messages=<n>] [--perf [--hitm-event=<raw>]]\n";
+}
+
+/// @brief Parse --csv, --json, --duration=, --epochs=, --messages=, --perf and --hitm-event=, exits on anything else
+inline Options parse_options(int argc, char** argv) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        const std::string_view arg = argv[i];
+        auto value = [&arg](std::string_view prefix) -> const char* {
+            return arg.starts_with(prefix) ? arg.data() + prefix.size() : nullptr;
+        };
+        if (arg == "--csv") {
+            options.format = Format::CSV;
+        } else if (arg == "--json") {
+            options.format = Format::JSON;
+        } else if (const char* v = value("--duration=")) {
+            options.duration = std::strtod(v, nullptr);
+        } else if (const char* v = value("--epochs=")) {
+            options.epochs = std::strtoull(v, nullptr, 10);
+        } else if (const char* v = value("--messages=")) {
+            options.messages = std::strtoull(v, nullptr, 10);
+        } else if (arg == "--perf") {
+            options.counters = true;
+        } else if (const char* v = value("--hitm-event=")) {
+            options.hitm_event = std::strtoull(v, nullptr, 0);
+        } else {
+            print_usage(argv[0]);
+            std::exit(1);
+        }
+    }
+    if (options.epochs == 0) {
+        options.epochs = 1;
+    }
+    if (options.hitm_event == 0) {
+        options.hitm_event = default_hitm_event();
+    }
+    if (options.counters && !PerfCounters(options.hitm_event).available()) {
+        std::cerr << "perf_event_open failed, counters are reported empty (see /proc/sys/kernel/perf_event_paranoid)\n";
+    }
+    return options;
+}
+
+/// @brief Producer and consumer thread counts of one run
+struct Threads {
+    size_t producers;
+    size_t consumers;
+};
+
+/// @brief Values swept for one implementation, every combination is measured for every payload size
+/// Points an adapter can not run (batch without native batch operations, more threads than it allows,
+/// placement unavailable on this machine) are skipped.
+struct Sweep {
+    std::vector<size_t> capacities{ QUEUE_CAPACITY };
+    std::vector<Placement> placements{ Placement::NONE };
+    std::vector<size_t> batches{ 1 };
+    std::vector<Threads> threads{ { 1, 1 } };
+};
+
+/// @brief One measured configuration
+struct Result {
+    std::string_view implementation;
+    size_t payload;
+    size_t capacity;
+    Placement placement;
+    size_t batch;
+    Threads threads;
+    double duration;
+    size_t messages;
+    size_t epochs;
+    long double mean;
+    long double min;
+    long double max;
+    CounterValues counters; // per operation averaged over the epochs, context switches per run, NaN if not measured
+};
+
+/// @brief Prints results as they come, CSV rows or elements of one JSON array
+class Reporter {
+public:
+    explicit Reporter(const Options& options, std::ostream& out = std::cout) : format_(options.format), counters_(options.counters), out_(out) {
+        out_ << std::fixed;
+        if (format_ == Format::CSV) {
+            out_ << "implementation,payload,capacity,placement,batch,producers,consumers,duration,messages,epochs,mean_ops,min_ops,max_ops";
+            if (counters_) {
+                for (size_t i = 0; i < COUNTER_COUNT; i++) {
+                    out_ << ',' << column(Counter(i));
+                }
+            }
+            out_ << '\n';
+        } else {
+            out_ << "[";
+        }
+    }
+
+    Reporter(const Reporter&) = delete;
+    Reporter& operator=(const Reporter&) = delete;
+
+    ~Reporter() {
+        if (format_ == Format::JSON) {
+            out_ << (rows_ == 0 ? "]\n" : "\n]\n");
+        }
+        out_.flush();
+    }
+
+    void add(const Result& result) {
+        if (format_ == Format::CSV) {
+            out_ << std::setprecision(3)
+                 << result.implementation << ',' << result.payload << ',' << result.capacity << ','
+                 << placement_name(result.placement) << ',' << result.batch << ','
+                 << result.threads.producers << ',' << result.threads.consumers << ','
+                 << result.duration << ',' << result.messages << ',' << result.epochs << ','
+                 << std::setprecision(0) << result.mean << ',' << result.min << ',' << result.max;
+            if (counters_) {
+                // Missing counters are left empty
+                out_ << std::setprecision(3);
+                for (double value : result.counters) {
+                    out_ << ',';
+                    if (!std::isnan(value)) {
+                        out_ << value;
+                    }
+                }
+            }
+            out_ << '\n';
+        } else {
+            out_ << (rows_ == 0 ? "\n" : ",\n") << std::setprecision(3)
+                 << "  {\"implementation\": \"" << result.implementation << "\", \"payload\": " << result.payload
+                 << ", \"capacity\": " << result.capacity << ", \"placement\": \"" << placement_name(result.placement)
+                 << "\", \"batch\": " << result.batch << ", \"producers\": " << result.threads.producers
+                 << ", \"consumers\": " << result.threads.consumers << ", \"duration\": " << result.duration
+                 << ", \"messages\": " << result.messages << ", \"epochs\": " << result.epochs
+                 << std::setprecision(0) << ", \"mean_ops\": " << result.mean << ", \"min_ops\": " << result.min
+                 << ", \"max_ops\": " << result.max;
+            if (counters_) {
+                out_ << std::setprecision(3);
+                for (size_t i = 0; i < COUNTER_COUNT; i++) {
+                    out_ << ", \"" << column(Counter(i)) << "\": ";
+                    if (std::isnan(result.counters[i])) {
+                        out_ << "null";
+                    } else {
+                        out_ << result.counters[i];
+                    }
+                }
+            }
+            out_ << "}";
+        }
+        out_.flush();
+        rows_++;
+    }
+
+private:
+    Format format_;
+    bool counters_;
+    std::ostream& out_;
+    size_t rows_ = 0;
+
+    /// @brief Counters are reported per operation, context switches per run
+    static std::string column(Counter counter) {
+        return counter == Counter::CONTEXT_SWITCHES ? counter_name(counter) : std::string(counter_name(counter)) + "_per_op";
+    }
+};
+
+/// @brief Adapter which places its memory by the threads using it, e.g. the ring on the consumer NUMA node
+template <typename Q>
+concept placed_queue = queue_adapter<Q> && std::constructible_from<Q, size_t, const ThreadPlacement&>;
+
+/// @brief Construct the queue of one run, placed queues get the CPUs of the run
+template <queue_adapter Queue>
+inline Queue make_queue(size_t capacity, const ThreadPlacement& placement) {
+    if constexpr (placed_queue<Queue>) {
+        return Queue(capacity, placement);
+    } else {
+        return Queue(capacity);
+    }
+}
+
+template <typename Producer, typename T>
+inline size_t send_some(Producer& producer, const T* values, size_t n) {
+    if constexpr (batch_producer<Producer, T>) {
+        if (n > 1) {
+            return producer.try_send_n(values, n);
+        }
+    }
+    size_t sent = 0;
+    while (sent < n && producer.try_send(values[sent])) {
+        sent++;
+    }
+    return sent;
+}
+
+template <typename Consumer, typename T>
+inline size_t receive_some(Consumer& consumer, T* values, size_t n) {
+    if constexpr (batch_consumer<Consumer, T>) {
+        if (n > 1) {
+            return consumer.try_receive_n(values, n);
+        }
+    }
+    size_t received = 0;
+    while (received < n && consumer.try_receive(values[received])) {
+        received++;
+    }
+    return received;
+}
+
+/// @brief Outcome of a single run
+struct Run {
+    long double throughput;
+    CounterValues counters; // per operation, context switches per run
+};
+
+/// @brief Single run, throughput is (sent + received) / seconds like the old benchmarks
+/// @param messages If not 0 producers send exactly that many values and the run ends when all are received, otherwise it runs for duration seconds
+/// @param perf Counters wrapped around the run, nullptr to measure throughput only
+/// @note Counters include the main thread, it only sleeps or waits for the workers
+template <queue_adapter Queue>
+Run measure(size_t capacity, const ThreadPlacement& placement, size_t batch, Threads threads, double duration, size_t messages, PerfCounters* perf = nullptr) {
+    using T = typename Queue::value_type;
+    Queue queue = make_queue<Queue>(capacity, placement);
+
+    std::atomic<bool> running{true};
+    std::atomic<size_t> remaining{messages};
+    std::vector<size_t> produced(threads.producers, 0);
+    std::vector<size_t> consumed(threads.consumers, 0);
+    std::vector<std::thread> workers;
+
+    if (perf != nullptr) {
+        perf->start();
+    }
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (size_t p = 0; p < threads.producers; ++p) {
+        const size_t quota = messages / threads.producers + (p < messages % threads.producers ? 1 : 0);
+        workers.emplace_back([producer = queue.producer(), &produced, &running, &placement, batch, messages, quota, p]() mutable {
+            if (placement.pinned) {
+                pin_thread(placement.producer_cpu);
+            }
+            std::vector<T> values(batch);
+            size_t sent = 0;
+            while (messages != 0 ? sent < quota : running.load(std::memory_order_relaxed)) {
+                sent += send_some(producer, values.data(), messages != 0 ? std::min(batch, quota - sent) : batch);
+            }
+            produced[p] = sent;
+        });
+    }
+    for (size_t c = 0; c < threads.consumers; ++c) {
+        workers.emplace_back([consumer = queue.consumer(), &consumed, &running, &remaining, &placement, batch, messages, c]() mutable {
+            if (placement.pinned) {
+                pin_thread(placement.consumer_cpu);
+            }
+            std::vector<T> values(batch);
+            size_t received = 0;
+            while (messages != 0 ? remaining.load(std::memory_order_relaxed) != 0 : running.load(std::memory_order_relaxed)) {
+                const size_t n = receive_some(consumer, values.data(), batch);
+                if (messages != 0 && n != 0) {
+                    remaining.fetch_sub(n, std::memory_order_relaxed);
+                }
+                received += n;
+            }
+            consumed[c] = received;
+        });
+    }
+
+    if (messages == 0) {
+        std::this_thread::sleep_for(std::chrono::duration<double>(duration));
+        running.store(false, std::memory_order_relaxed);
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    CounterValues counters = perf != nullptr ? perf->stop() : unavailable_counters();
+    std::chrono::duration<double> actual_duration = end - start;
+    size_t total = 0;
+    for (size_t sent : produced) {
+        total += sent;
+    }
+    for (size_t received : consumed) {
+        total += received;
+    }
+    for (size_t i = 0; i < COUNTER_COUNT; i++) {
+        if (Counter(i) != Counter::CONTEXT_SWITCHES) {
+            counters[i] /= static_cast<double>(std::max<size_t>(total, 1));
+        }
+    }
+    return { static_cast<long double>(total) / actual_duration.count(), counters };
+}
+
+/// @brief Measure every point of the sweep for one queue type and report the average of options.epochs runs
+template <queue_adapter Queue>
+void run_payload_sweep(const Options& options, const Sweep& sweep, Reporter& reporter) {
+    using T = typename Queue::value_type;
+    std::optional<PerfCounters> perf;
+    if (options.counters) {
+        perf.emplace(options.hitm_event);
+    }
+    for (size_t capacity : sweep.capacities) {
+        if (capacity * sizeof(T) > MAX_RING_BYTES) {
+            continue;
+        }
+        for (Placement placement : sweep.placements) {
+            const auto cpus = resolve_placement(placement);
+            if (!cpus) {
+                continue;
+            }
+            for (Threads threads : sweep.threads) {
+                if ((threads.producers > 1 && !Queue::multi_producer) || (threads.consumers > 1 && !Queue::multi_consumer)) {
+                    continue;
+                }
+                // every producer would land on the same CPU, pinning only makes sense for one pair
+                if (cpus->pinned && (threads.producers > 1 || threads.consumers > 1)) {
+                    continue;
+                }
+                for (size_t batch : sweep.batches) {
+                    using Producer = decltype(std::declval<Queue&>().producer());
+                    using Consumer = decltype(std::declval<Queue&>().consumer());
+                    if (batch > 1 && !(batch_producer<Producer, T> && batch_consumer<Consumer, T>)) {
+                        continue;
+                    }
+
+                    measure<Queue>(capacity, *cpus, batch, threads, 0.0, WARMUP_QUANTITY);
+                    Result result{ Queue::name, sizeof(T), capacity, placement, batch, threads, options.messages == 0 ? options.duration : 0.0, options.messages, options.epochs, 0.0, 0.0, 0.0, {} };
+                    for (size_t i = 0; i < options.epochs; i++) {
+                        const Run run = measure<Queue>(capacity, *cpus, batch, threads, options.duration, options.messages, perf ? &*perf : nullptr);
+                        result.mean += run.throughput / options.epochs;
+                        result.min = i == 0 ? run.throughput : std::min(result.min, run.throughput);
+                        result.max = std::max(result.max, run.throughput);
+                        for (size_t c = 0; c < COUNTER_COUNT; c++) {
+                            result.counters[c] += run.counters[c] / options.epochs;
+                        }
+                    }
+                    reporter.add(result);
+                }
+            }
+        }
+    }
+}
+
+/// @brief Run the sweep for every payload size, 4 B, 64 B, 512 B and 4 KB if none are given
+/// @tparam Queue Adapter template, instantiated with Payload<Size> for every size
+template <template <typename> class Queue, size_t... Sizes>
+void run_sweep(const Options& options, const Sweep& sweep, Reporter& reporter) {
+    if constexpr (sizeof...(Sizes) == 0) {
+        run_sweep<Queue, 4, 64, 512, 4096>(options, sweep, reporter);
+    } else {
+        (run_payload_sweep<Queue<Payload<Sizes>>>(options, sweep, reporter), ...);
+    }
+}
+
+}
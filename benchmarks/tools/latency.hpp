@@ -0,0 +1,156 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Latency Measurement Tools
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// Timestamps and latency histogram used in latency benchmarks
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace channels::benchmarks {
+
+/// @brief Read the timestamp counter, steady_clock nanoseconds where there is no usable one
+/// @note The TSC is assumed to be invariant and synchronized between cores, true for all recent x86 CPUs
+inline uint64_t now_ticks() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+/// @brief Number of ticks per nanosecond, measured once against steady_clock
+inline double ticks_per_ns() {
+#if defined(__x86_64__) || defined(__i386__)
+    static const double ratio = []() {
+        const auto start = std::chrono::steady_clock::now();
+        const uint64_t start_ticks = now_ticks();
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        const uint64_t end_ticks = now_ticks();
+        const auto end = std::chrono::steady_clock::now();
+        return static_cast<double>(end_ticks - start_ticks) / std::chrono::duration<double, std::nano>(end - start).count();
+    }();
+    return ratio;
+#else
+    return 1.0;
+#endif
+}
+
+/// @brief HDR style histogram with log-linear buckets
+/// Values below 2^SubBucketBits are counted exactly, above that every power of two is split
+/// into 2^(SubBucketBits - 1) buckets, so the relative error stays under 2^(1 - SubBucketBits).
+/// Recording is a couple of instructions and never allocates.
+template <size_t SubBucketBits = 7>
+class LatencyHistogram {
+    static constexpr size_t half = size_t(1) << (SubBucketBits - 1);
+    static constexpr size_t bucket_count = (64 - SubBucketBits + 2) * half;
+public:
+    LatencyHistogram() : counts_(bucket_count, 0) {}
+
+    inline void record(uint64_t value) noexcept {
+        counts_[index_of(value)]++;
+        total_++;
+        max_ = std::max(max_, value);
+    }
+
+    uint64_t count() const noexcept {
+        return total_;
+    }
+
+    uint64_t max() const noexcept {
+        return max_;
+    }
+
+    /// @brief Value at given percentile (0-100), the highest value of the bucket it falls in
+    uint64_t percentile(double p) const noexcept {
+        if (total_ == 0) {
+            return 0;
+        }
+        const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(p / 100.0 * static_cast<double>(total_) + 0.5));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < bucket_count; i++) {
+            seen += counts_[i];
+            if (seen >= rank) {
+                return std::min(highest_of(i), max_);
+            }
+        }
+        return max_;
+    }
+
+private:
+    static inline size_t index_of(uint64_t value) noexcept {
+        if (value < (uint64_t(1) << SubBucketBits)) {
+            return static_cast<size_t>(value);
+        }
+        const size_t exponent = std::bit_width(value) - SubBucketBits;
+        return exponent * half + static_cast<size_t>(value >> exponent);
+    }
+
+    static inline uint64_t highest_of(size_t index) noexcept {
+        if (index < (size_t(1) << SubBucketBits)) {
+            return index;
+        }
+        const size_t exponent = index / half - 1;
+        const uint64_t mantissa = index - exponent * half;
+        return ((mantissa + 1) << exponent) - 1;
+    }
+
+    std::vector<uint64_t> counts_;
+    uint64_t total_ = 0;
+    uint64_t max_ = 0;
+};
+
+/// @brief Print table header matching print_latency_row
+inline void print_latency_header(const std::string& first_column) {
+    std::cout << std::left << std::setw(40) << first_column << std::right
+              << std::setw(10) << "p50" << std::setw(10) << "p90" << std::setw(10) << "p99"
+              << std::setw(10) << "p99.9" << std::setw(12) << "max" << "   (ns)\n";
+}
+
+/// @brief Print percentiles of a histogram recorded in ticks, converted to nanoseconds
+template <size_t SubBucketBits>
+void print_latency_row(const std::string& name, const LatencyHistogram<SubBucketBits>& histogram) {
+    const double ratio = ticks_per_ns();
+    auto ns = [ratio](uint64_t ticks) { return static_cast<uint64_t>(static_cast<double>(ticks) / ratio); };
+    std::cout << std::left << std::setw(40) << name << std::right
+              << std::setw(10) << ns(histogram.percentile(50.0))
+              << std::setw(10) << ns(histogram.percentile(90.0))
+              << std::setw(10) << ns(histogram.percentile(99.0))
+              << std::setw(10) << ns(histogram.percentile(99.9))
+              << std::setw(12) << ns(histogram.max()) << "\n";
+}
+
+} // namespace channels::benchmarks
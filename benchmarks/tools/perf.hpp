@@ -0,0 +1,198 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Benchmark Performance Counters
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/// Hardware and scheduler counters of benchmark runs, read with perf_event_open (Linux only).
+/// Counters are opened on the main thread with inherit set, so producer and consumer threads started
+/// afterwards are counted as well, their counts are folded into the totals when they exit.
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <string>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace channels::benchmarks {
+
+enum class Counter : size_t {
+    CYCLES,
+    INSTRUCTIONS,
+    L1D_MISSES,         // L1 data cache read misses
+    LLC_MISSES,         // last level cache read misses
+    HITM,               // loads served from a line modified in another core's cache, see default_hitm_event
+    CONTEXT_SWITCHES,
+};
+
+constexpr size_t COUNTER_COUNT = 6;
+
+constexpr const char* counter_name(Counter counter) {
+    switch (counter) {
+        case Counter::CYCLES: return "cycles";
+        case Counter::INSTRUCTIONS: return "instructions";
+        case Counter::L1D_MISSES: return "l1d_misses";
+        case Counter::LLC_MISSES: return "llc_misses";
+        case Counter::HITM: return "hitm";
+        case Counter::CONTEXT_SWITCHES: return "context_switches";
+    }
+    return "";
+}
+
+/// @brief Value of every counter, NaN for the ones this machine or kernel does not provide
+using CounterValues = std::array<double, COUNTER_COUNT>;
+
+inline CounterValues unavailable_counters() {
+    CounterValues values;
+    values.fill(std::numeric_limits<double>::quiet_NaN());
+    return values;
+}
+
+/// @brief Raw event counting cache to cache transfers of modified lines, 0 if there is none for this cpu
+/// Intel MEM_LOAD_L3_HIT_RETIRED.XSNP_HITM (event 0xd2, umask 0x04, named XSNP_FWD on newer cores) from Haswell on.
+/// Other vendors have no equivalent with a stable encoding, pass one with --hitm-event= instead.
+inline uint64_t default_hitm_event() {
+#ifdef __linux__
+    std::ifstream cpuinfo("/proc/cpuinfo");
+    std::string line;
+    while (std::getline(cpuinfo, line)) {
+        if (line.starts_with("vendor_id")) {
+            return line.find("GenuineIntel") != std::string::npos ? 0x04d2 : 0;
+        }
+    }
+#endif
+    return 0;
+}
+
+/// @brief Group of counters measuring the threads started between start() and stop()
+class PerfCounters {
+public:
+    /// @param hitm_event Raw event used for Counter::HITM, 0 leaves it out
+    explicit PerfCounters(uint64_t hitm_event) {
+        fds_.fill(-1);
+#ifdef __linux__
+        constexpr uint64_t read_miss = (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        fds_[size_t(Counter::CYCLES)] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        fds_[size_t(Counter::INSTRUCTIONS)] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        fds_[size_t(Counter::L1D_MISSES)] = open_counter(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | read_miss);
+        fds_[size_t(Counter::LLC_MISSES)] = open_counter(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL | read_miss);
+        if (hitm_event != 0) {
+            fds_[size_t(Counter::HITM)] = open_counter(PERF_TYPE_RAW, hitm_event);
+        }
+        fds_[size_t(Counter::CONTEXT_SWITCHES)] = open_counter(PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES);
+#else
+        (void)hitm_event;
+#endif
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    ~PerfCounters() {
+#ifdef __linux__
+        for (int fd : fds_) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+#endif
+    }
+
+    /// @brief True if at least one counter could be opened
+    bool available() const noexcept {
+        for (int fd : fds_) {
+            if (fd >= 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// @brief Reset and enable every counter, threads started afterwards inherit them
+    void start() noexcept {
+#ifdef __linux__
+        for (int fd : fds_) {
+            if (fd >= 0) {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+    }
+
+    /// @brief Disable the counters and read their totals, call it once the measured threads were joined
+    /// @note Counts of counters the kernel had to multiplex are scaled up to the whole run
+    CounterValues stop() noexcept {
+        CounterValues values = unavailable_counters();
+#ifdef __linux__
+        for (size_t i = 0; i < COUNTER_COUNT; i++) {
+            if (fds_[i] < 0) {
+                continue;
+            }
+            ioctl(fds_[i], PERF_EVENT_IOC_DISABLE, 0);
+            uint64_t data[3] = {}; // value, time enabled, time running
+            if (read(fds_[i], data, sizeof(data)) != sizeof(data)) {
+                continue;
+            }
+            if (data[2] != 0) {
+                values[i] = static_cast<double>(data[0]) * (static_cast<double>(data[1]) / static_cast<double>(data[2]));
+            } else if (data[1] == 0) {
+                values[i] = 0.0; // never enabled while a counted thread ran
+            }
+        }
+#endif
+        return values;
+    }
+
+private:
+    std::array<int, COUNTER_COUNT> fds_;
+
+#ifdef __linux__
+    /// @return File descriptor of the counter or -1 if this machine or kernel does not provide it
+    static int open_counter(uint32_t type, uint64_t config) {
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = 1;
+        attr.inherit = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        if (fd < 0) {
+            // perf_event_paranoid 2 and above allows unprivileged users to count user space only
+            attr.exclude_kernel = 1;
+            fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        }
+        return fd;
+    }
+#endif
+};
+
+}
@@ -25,6 +25,7 @@
 
  #include <iostream>
  #include <thread>
+ #include <atomic>
  #include <arc_ptr.hpp>
 
 using namespace channels;
@@ -51,9 +52,31 @@ void example() {
     std::cout << "Arc_ptr value: " << *aptr2 << " (again) \n";
 }
 
+// Types that can not be copied or moved are constructed in place inside the control block
+struct Counter {
+    std::atomic<int> value;
+    explicit Counter(int start) : value(start) {}
+};
+
+// weak_arc does not keep the value alive, so the owner can be dropped while others still check on it
+void weak_example() {
+    arc_ptr<Counter> counter(std::in_place, 5);
+    arc_ptr<Counter> allocated = allocate_arc<Counter>(std::allocator<Counter>(), 10);
+    weak_arc<Counter> observer = counter;
+
+    if (auto alive = observer.lock()) {
+        alive.get_mut()->value.fetch_add(1);
+        std::cout << "Counter is alive: " << alive->value.load() << ", allocated one: " << allocated->value.load() << "\n";
+    }
+
+    counter = nullptr;
+    std::cout << "Counter expired: " << std::boolalpha << observer.expired() << "\n";
+}
+
 int main() {
 
     example();
+    weak_example();
 
     return 0;
  }
\ No newline at end of file
@@ -0,0 +1,91 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Broadcast Channel Usage Examples
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <broadcast.hpp>
+#include <thread>
+#include <vector>
+#include <iostream>
+
+using namespace channels;
+using namespace channels::broadcast;
+
+struct Quote {
+    uint64_t sequence;
+    double bid;
+    double ask;
+};
+
+// Every strategy thread sees every quote, the feed writes each one once
+void example_fan_out() {
+    auto [sender, receivers] = channel<Quote, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::YIELD>(64, 3);
+
+    std::vector<std::thread> strategies;
+    for (size_t s = 0; s < receivers.size(); ++s) {
+        strategies.emplace_back([receiver = std::move(receivers[s]), s]() mutable {
+            Quote quote;
+            double spread = 0;
+            uint64_t count = 0;
+            while (receiver.receive(quote) == ResponseStatus::SUCCESS) {
+                spread += quote.ask - quote.bid;
+                ++count;
+            }
+            std::cout << "Strategy " << s << " got " << count << " quotes, average spread " << spread / count << std::endl;
+        });
+    }
+
+    for (uint64_t i = 0; i < 1000; ++i) {
+        sender.send(Quote{ i, 100.0 + i * 0.01, 100.02 + i * 0.01 });
+    }
+    sender.close(); // receivers drain the ring and then get SENDER_CLOSED
+
+    for (auto& strategy : strategies) {
+        strategy.join();
+    }
+}
+
+// The feed never waits, a receiver that falls a whole ring behind skips to the oldest quote still there
+void example_overwrite() {
+    auto [sender, receivers] = channel<Quote, OverflowStrategy::OVERWRITE_ON_FULL>(16, 1);
+    Receiver<Quote, OverflowStrategy::OVERWRITE_ON_FULL> slow = std::move(receivers[0]);
+
+    for (uint64_t i = 0; i < 100; ++i) {
+        sender.send(Quote{ i, 100.0, 100.02 });
+    }
+
+    Quote quote{};
+    if (slow.try_receive(quote) == ResponseStatus::SUCCESS) {
+        std::cout << "First quote received: " << quote.sequence << ", missed: " << slow.missed() << std::endl;
+    }
+}
+
+int main() {
+    std::cout << "Example: Fan-out" << std::endl;
+    example_fan_out();
+
+    std::cout << "Example: Overwrite" << std::endl;
+    example_overwrite();
+
+    return 0;
+}
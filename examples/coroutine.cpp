@@ -0,0 +1,122 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Coroutine Usage Examples
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <coroutine>
+#include <exception>
+#include <iostream>
+#include <thread>
+
+#include <spsc.hpp>
+#include <oneshot.hpp>
+#include <mpsc.hpp>
+
+using channels::WaitStrategy;
+using channels::OverflowStrategy;
+using channels::ResponseStatus;
+
+/// Minimal fire-and-forget coroutine type, any task type of your coroutine library works the same way
+struct task {
+    struct promise_type {
+        task get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+};
+
+/// Executor resuming coroutines on the thread that runs it, backed by an mpsc channel
+struct run_loop {
+    using Channel = channels::mpsc::Sender<std::coroutine_handle<>, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::ADAPTIVE>;
+
+    void schedule(std::coroutine_handle<> handle) noexcept {
+        queue.send(handle);
+    }
+
+    void stop() noexcept {
+        queue.send(std::coroutine_handle<>{});
+    }
+
+    Channel queue;
+};
+
+task produce(channels::spsc::Sender<int, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::ASYNC>& sender) {
+    for (int i = 0; i < 8; i++) {
+        // Suspends once the channel is full, the receiver resumes it when it frees a slot
+        co_await sender.async_send(i);
+    }
+    sender.close();
+}
+
+task consume(channels::spsc::Receiver<int, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::ASYNC>& receiver) {
+    int value;
+    while (co_await receiver.async_receive(value) == ResponseStatus::SUCCESS) {
+        std::cout << "Received: " << value << std::endl;
+    }
+    std::cout << "Sender closed" << std::endl;
+}
+
+/// Both coroutines run on the main thread and resume each other inline
+void example() {
+    auto [sender, receiver] = channels::spsc::channel<int, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::ASYNC>(4);
+
+    consume(receiver); // suspends right away, the channel is empty
+    produce(sender);
+}
+
+task await_answer(channels::oneshot::Receiver<int, WaitStrategy::ASYNC>& receiver, run_loop& loop) {
+    int answer = co_await receiver.async_receive(loop);
+    std::cout << "Answer " << answer << " on the run loop thread" << std::endl;
+    loop.stop();
+}
+
+/// The coroutine waits for a value from another thread and is resumed on the run loop, not on the sender thread
+void executor_example() {
+    auto [queue_sender, queue_receiver] = channels::mpsc::channel<std::coroutine_handle<>, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::ADAPTIVE>(64);
+    run_loop loop{ queue_sender };
+
+    auto [sender, receiver] = channels::oneshot::channel<int, WaitStrategy::ASYNC>();
+    await_answer(receiver, loop);
+
+    std::thread t1([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        sender.send(57);
+    });
+
+    while (std::coroutine_handle<> handle = queue_receiver.receive()) {
+        handle.resume();
+    }
+    t1.join();
+}
+
+int main() {
+    std::cout << "---- Inline example ----" << std::endl;
+    example();
+
+    std::cout << "---- Executor example ----" << std::endl;
+    executor_example();
+
+    return 0;
+}
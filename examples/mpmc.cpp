@@ -0,0 +1,71 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * MPMC Channel Usage Examples
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <mpmc.hpp>
+#include <thread>
+#include <vector>
+#include <iostream>
+
+using namespace channels;
+using namespace channels::mpmc;
+
+
+// Tasks are spread over a pool of workers, every thread gets its own copy of the handle
+void example_worker_pool() {
+    auto [sender, receiver] = channel<int>(16);
+
+    std::vector<std::thread> workers;
+    for (int w = 0; w < 4; ++w) {
+        workers.emplace_back([receiver = receiver, w]() mutable {
+            for (int i = 0; i < 25; ++i) {
+                int task = receiver.receive();
+                std::cout << "Worker " << w << " got task: " << task << std::endl;
+            }
+        });
+    }
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < 2; ++p) {
+        producers.emplace_back([sender = sender, p]() mutable {
+            for (int i = 0; i < 50; ++i) {
+                sender.send(p * 100 + i);
+            }
+        });
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+int main() {
+    std::cout << "Example: Worker Pool" << std::endl;
+    example_worker_pool();
+
+    return 0;
+}
@@ -0,0 +1,91 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * MPSC Channel Usage Examples
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <mpsc.hpp>
+#include <thread>
+#include <vector>
+#include <iostream>
+
+using namespace channels;
+using namespace channels::mpsc;
+
+
+// Every producer gets its own copy of the sender
+void example_simple() {
+    auto [sender, receiver] = channel<int>(16);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < 4; ++p) {
+        producers.emplace_back([sender = sender, p]() mutable {
+            for (int i = 0; i < 25; ++i) {
+                sender.send(p * 100 + i);
+            }
+        });
+    }
+
+    std::thread consumer([receiver = std::move(receiver)]() mutable {
+        for (int i = 0; i < 100; ++i) {
+            int value = receiver.receive();
+            std::cout << "Received: " << value << std::endl;
+        }
+    });
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    consumer.join();
+}
+
+void example_overflowable() {
+    auto [sender, receiver] = channel<int, OverflowStrategy::OVERWRITE_ON_FULL>(16);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < 4; ++p) {
+        producers.emplace_back([sender = sender, p]() mutable {
+            for (int i = 0; i < 25; ++i) {
+                sender.send(p * 100 + i);
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    // Only the 16 newest values are left
+    int value;
+    while (receiver.try_receive(value) == ResponseStatus::SUCCESS) {
+        std::cout << "Received: " << value << std::endl;
+    }
+}
+
+int main() {
+    std::cout << "Example: Simple" << std::endl;
+    example_simple();
+
+    std::cout << "Example: Overflowable" << std::endl;
+    example_overflowable();
+
+    return 0;
+}
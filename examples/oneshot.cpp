@@ -60,6 +60,25 @@ void waiting_example() {
     t1.join();
 }
 
+/// Serial request/response on a single channel, reset() gives a new sender without allocating
+void reuse_example() {
+    auto [sender, receiver] = channel<int, channels::WaitStrategy::YIELD>();
+
+    for (int round = 0; round < 3; round++) {
+        std::thread t1([&, round]() {
+            sender.send(round * 10);
+        });
+        std::cout << "Round " << round << " received: " << receiver.receive() << std::endl;
+        t1.join();
+
+        Sender<int, channels::WaitStrategy::YIELD> stale = std::move(sender);
+        sender = receiver.reset();
+        if (stale.send(-1) == channels::ResponseStatus::SENDER_CLOSED) {
+            std::cout << "Stale sender rejected" << std::endl;
+        }
+    }
+}
+
 int main() {
     std::cout << "---- Basic example ----" << std::endl;
     example();
@@ -67,5 +86,8 @@ int main() {
     std::cout << "---- Waiting example ----" << std::endl;
     waiting_example();
 
+    std::cout << "---- Reuse example ----" << std::endl;
+    reuse_example();
+
     return 0;
 }
\ No newline at end of file
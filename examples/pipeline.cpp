@@ -0,0 +1,120 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Pipeline Example
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <pipeline.hpp>
+
+using namespace channels;
+
+struct Frame {
+    int id = 0;
+    float level = 0.0f;
+};
+
+/// decode -> transform -> encode, every stage runs on whichever worker is free
+void example() {
+    pipeline::thread_pool pool(4);
+    pipeline::graph graph(pool);
+
+    auto packets = graph.make_edge<int>(1024);
+    auto frames = graph.make_edge<Frame>(256);
+    auto encoded = graph.make_edge<std::string>(256);
+
+    auto input = graph.make_source(packets);
+
+    // Value by value, one Frame per packet
+    graph.stage(packets, frames, [](int& packet) -> Frame {
+        return Frame{ packet, static_cast<float>(packet % 100) / 100.0f };
+    });
+
+    // Batch stage, called once at least 32 frames are waiting (the rest comes when the input closes)
+    graph.stage(frames, encoded, [](std::span<Frame> batch, std::vector<std::string>& out) {
+        float peak = 0.0f;
+        for (const Frame& frame : batch) {
+            peak = std::max(peak, frame.level);
+        }
+        out.push_back("frames " + std::to_string(batch.front().id) + ".." + std::to_string(batch.back().id) + " peak " + std::to_string(peak));
+    }, { .min_batch = 32, .max_batch = 256 });
+
+    size_t lines = 0;
+    graph.sink(encoded, [&lines](std::string& line) {
+        if (lines++ < 3) {
+            std::cout << line << std::endl;
+        }
+    });
+
+    graph.start();
+    for (int i = 0; i < 100000; i++) {
+        input.send(i); // waits while the first edge is full
+    }
+    input.close();
+
+    graph.wait();
+    std::cout << "Encoded " << lines << " batches" << std::endl;
+}
+
+/// Two sources merged into one stage through an mpsc edge
+void fan_in_example() {
+    pipeline::thread_pool pool(2);
+    pipeline::graph graph(pool);
+
+    auto merged = graph.make_edge<int, pipeline::EdgeKind::MPSC>(256);
+    auto left = graph.make_source(merged);
+    auto right = graph.make_source(merged);
+
+    long long sum = 0;
+    graph.sink(merged, [&sum](std::span<int> batch) {
+        for (int value : batch) {
+            sum += value;
+        }
+    });
+    graph.start();
+
+    std::thread t1([&]() {
+        for (int i = 0; i < 1000; i++) {
+            left.send(i);
+        }
+        left.close();
+    });
+    for (int i = 0; i < 1000; i++) {
+        right.send(-i);
+    }
+    right.close();
+    t1.join();
+
+    graph.wait();
+    std::cout << "Sum of merged values: " << sum << std::endl;
+}
+
+int main() {
+    std::cout << "---- Pipeline example ----" << std::endl;
+    example();
+
+    std::cout << "---- Fan-in example ----" << std::endl;
+    fan_in_example();
+    return 0;
+}
@@ -0,0 +1,164 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Select Usage Examples
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <select.hpp>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#endif
+
+using namespace channels;
+
+using IntSender = spsc::Sender<int, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::ADAPTIVE>;
+using IntReceiver = spsc::Receiver<int, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::ADAPTIVE>;
+
+/// One consumer reading from a channel per producer, it visits only the channels that have data
+void example() {
+    constexpr int producers = 4;
+    std::vector<IntSender> senders(producers);
+    std::vector<IntReceiver> receivers(producers);
+    selector sel(producers);
+    for (int i = 0; i < producers; i++) {
+        auto [sender, receiver] = spsc::channel<int, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::ADAPTIVE>(16);
+        senders[i] = std::move(sender);
+        receivers[i] = std::move(receiver);
+        sel.add(receivers[i]); // indices are handed out in order, starting from 0
+    }
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < producers; i++) {
+        threads.emplace_back([&, i]() {
+            for (int value = 0; value < 3; value++) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10 * (i + 1)));
+                senders[i].send(i * 100 + value);
+            }
+            senders[i].close();
+        });
+    }
+
+    int open = producers;
+    while (open > 0) {
+        const size_t index = sel.select();
+        int value;
+        const ResponseStatus status = receivers[index].try_receive(value);
+        if (status == ResponseStatus::SUCCESS) {
+            std::cout << "Channel " << index << " received: " << value << std::endl;
+        } else if (status == ResponseStatus::SENDER_CLOSED) {
+            sel.remove(index);
+            open--;
+        }
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+/// Waiting for the first of two answers, with a timeout
+void oneshot_example() {
+    auto [fast_sender, fast_receiver] = oneshot::channel<int, WaitStrategy::ADAPTIVE>();
+    auto [slow_sender, slow_receiver] = oneshot::channel<int, WaitStrategy::ADAPTIVE>();
+    selector sel(2);
+    const size_t fast = sel.add(fast_receiver);
+    sel.add(slow_receiver);
+
+    std::thread t1([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        fast_sender.send(1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        slow_sender.send(2);
+    });
+
+    const size_t index = sel.select_for(std::chrono::milliseconds(100));
+    int value;
+    if (index == fast && fast_receiver.try_receive(value) == ResponseStatus::SUCCESS) {
+        std::cout << "First answer: " << value << std::endl;
+    }
+    sel.remove(fast);
+    if (sel.select_for(std::chrono::milliseconds(100)) == selector::npos) {
+        std::cout << "Second answer timed out" << std::endl;
+    }
+
+    t1.join();
+}
+
+#if defined(__linux__)
+/// Channel traffic handled by an epoll loop, the loop sleeps in epoll_wait while the channel is empty
+void epoll_example() {
+    auto [sender, receiver] = spsc::channel<int, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::ADAPTIVE>(16);
+    selector sel(1, true);
+    sel.add(receiver);
+
+    const int epoll = epoll_create1(0);
+    epoll_event event{};
+    event.events = EPOLLIN;
+    epoll_ctl(epoll, EPOLL_CTL_ADD, sel.fd(), &event); // sockets would be registered here as well
+
+    std::thread t1([&]() {
+        for (int value = 0; value < 3; value++) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            sender.send(value);
+        }
+        sender.close();
+    });
+
+    bool open = true;
+    while (open && epoll_wait(epoll, &event, 1, -1) == 1) {
+        sel.drain_fd();
+        size_t index;
+        while ((index = sel.try_select()) != selector::npos) {
+            int value;
+            if (receiver.try_receive(value) == ResponseStatus::SUCCESS) {
+                std::cout << "Event loop received: " << value << std::endl;
+            } else {
+                sel.remove(index);
+                open = false;
+            }
+        }
+    }
+
+    t1.join();
+    close(epoll);
+}
+#endif
+
+int main() {
+    std::cout << "---- SPSC example ----" << std::endl;
+    example();
+
+    std::cout << "---- Oneshot example ----" << std::endl;
+    oneshot_example();
+
+#if defined(__linux__)
+    std::cout << "---- Epoll example ----" << std::endl;
+    epoll_example();
+#endif
+
+    return 0;
+}
@@ -33,6 +33,7 @@
 
 #include <spsc.hpp>
 #include <thread>
+#include <algorithm>
 #include <iostream>
 
 using namespace channels;
@@ -188,7 +189,7 @@ void example_overflowable() {
     std::this_thread::sleep_for(std::chrono::seconds(1));
 
     std::thread consumer([&]() {
-        int value;
+        int value{};
         while (receiver.try_receive(value) != ResponseStatus::CHANNEL_EMPTY) {
             std::cout << "Received: " << value << std::endl;
         }
@@ -295,6 +296,115 @@ void example_testing_struct() {
     // std::cout << "Received: " << v3.id << std::endl;
 }
 
+struct Frame {
+    int id;
+    char samples[4096];
+};
+
+// Large frames are written and read directly in the ring, without copying them in and out
+void example_zero_copy() {
+    auto [sender, receiver] = channel<Frame>(16);
+
+    std::thread producer([&]() {
+        int produced = 0;
+        while (produced < 100) {
+            RingSpan<Frame> slots = sender.reserve(std::min(8, 100 - produced));
+            for (size_t i = 0; i < slots.size(); ++i) {
+                slots[i].id = produced + static_cast<int>(i);
+                std::fill(std::begin(slots[i].samples), std::end(slots[i].samples), static_cast<char>(i));
+            }
+            sender.commit(slots.size());
+            produced += static_cast<int>(slots.size());
+        }
+    });
+
+    std::thread consumer([&]() {
+        int consumed = 0;
+        while (consumed < 100) {
+            RingSpan<Frame> frames = receiver.peek();
+            for (size_t i = 0; i < frames.size(); ++i) {
+                std::cout << "Received frame: " << frames[i].id << std::endl;
+            }
+            receiver.release(frames.size());
+            consumed += static_cast<int>(frames.size());
+        }
+    });
+
+    producer.join();
+    consumer.join();
+}
+
+/// Simple allocator that reports every allocation, it can be replaced with an arena, huge page or NUMA aware allocator
+template <typename T>
+struct LoggingAllocator {
+    using value_type = T;
+
+    LoggingAllocator() = default;
+    template <typename U>
+    LoggingAllocator(const LoggingAllocator<U>&) noexcept {}
+
+    T* allocate(size_t n) {
+        std::cout << "Allocating " << n * sizeof(T) << " bytes" << std::endl;
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept {
+        std::cout << "Deallocating " << n * sizeof(T) << " bytes" << std::endl;
+        std::allocator<T>().deallocate(ptr, n);
+    }
+
+    template <typename U>
+    bool operator==(const LoggingAllocator<U>&) const noexcept { return true; }
+};
+
+// Both the ring buffer and the shared control block are allocated with the given allocator
+void example_custom_allocator() {
+    auto [sender, receiver] = channel<int>(16, LoggingAllocator<int>());
+
+    sender.send(57);
+    std::cout << "Received: " << receiver.receive() << std::endl;
+}
+
+// Event loops can wait for a message with a deadline instead of polling try_receive
+void example_timed() {
+    auto [sender, receiver] = channel<int, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::ADAPTIVE>(16);
+
+    int value;
+    if (receiver.receive_for(value, std::chrono::milliseconds(100)) == ResponseStatus::CHANNEL_EMPTY) {
+        std::cout << "Nothing received within 100ms" << std::endl;
+    }
+
+    std::thread producer([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        sender.send(57);
+    });
+
+    if (receiver.receive_for(value, std::chrono::seconds(1)) == ResponseStatus::SUCCESS) {
+        std::cout << "Received: " << value << std::endl;
+    }
+    producer.join();
+}
+
+// Capacity known at compile time, the ring lives inside the object and nothing touches the heap
+static static_channel<float, 256> audio_blocks;
+
+void example_static() {
+    auto [sender, receiver] = audio_blocks.split();
+
+    std::thread producer([&]() {
+        for (int i = 0; i < 8; i++) {
+            sender.send(i * 0.5f);
+        }
+    });
+
+    float sum = 0;
+    for (int i = 0; i < 8; i++) {
+        sum += receiver.receive();
+    }
+    producer.join();
+    std::cout << "Sum: " << sum << std::endl;
+}
+
 int main() {
     std::cout << "Example: Simple" << std::endl;
     example_simple();
@@ -311,5 +421,17 @@ int main() {
     std::cout << "Example: Secure Move by Value" << std::endl;
     example_testing_struct();
 
+    std::cout << "Example: Zero Copy" << std::endl;
+    example_zero_copy();
+
+    std::cout << "Example: Custom Allocator" << std::endl;
+    example_custom_allocator();
+
+    std::cout << "Example: Timed" << std::endl;
+    example_timed();
+
+    std::cout << "Example: Static" << std::endl;
+    example_static();
+
     return 0;
 }
@@ -0,0 +1,67 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Shared Memory SPSC Channel Usage Examples
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <spsc_shm.hpp>
+#include <iostream>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace channels;
+using namespace channels::spsc::shm;
+
+struct Tick {
+    int id;
+    double price;
+};
+
+// Producer and consumer live in separate processes, only trivially copyable values can be sent
+void example_processes() {
+    const std::string name = "/channels_example_ticks";
+    remove(name); // in case previous run crashed
+
+    auto sender = Sender<Tick>::create(name, 16);
+
+    pid_t pid = ::fork();
+    if (pid == 0) {
+        auto receiver = Receiver<Tick>::open(name);
+        for (int i = 0; i < 100; ++i) {
+            Tick tick = receiver.receive();
+            std::cout << "Received tick: " << tick.id << " price: " << tick.price << std::endl;
+        }
+        std::exit(0);
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        sender.send(Tick{ i, 100.0 + i });
+    }
+    ::waitpid(pid, nullptr, 0);
+}
+
+int main() {
+    std::cout << "Example: Processes" << std::endl;
+    example_processes();
+
+    return 0;
+}
@@ -0,0 +1,59 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Unbounded SPSC Channel Usage Examples
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <spsc_unbounded.hpp>
+#include <thread>
+#include <iostream>
+
+using namespace channels;
+using namespace channels::spsc::unbounded;
+
+
+// Sender never waits, bursts are absorbed by linking more segments
+void example_burst() {
+    auto [sender, receiver] = channel<int>(16);
+
+    std::thread producer([sender = std::move(sender)]() mutable {
+        for (int i = 0; i < 1000; ++i) {
+            sender.send(i);
+        }
+    });
+    producer.join();
+
+    std::thread consumer([receiver = std::move(receiver)]() mutable {
+        for (int i = 0; i < 1000; ++i) {
+            int value = receiver.receive();
+            std::cout << "Received: " << value << std::endl;
+        }
+    });
+    consumer.join();
+}
+
+int main() {
+    std::cout << "Example: Burst" << std::endl;
+    example_burst();
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Topology Example
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <thread>
+#include <spsc.hpp>
+#include <mmap_allocator.hpp>
+#include <topology.hpp>
+#include <iostream>
+
+using namespace channels;
+
+/// Print where every cpu is, SMT siblings share a core, cores share a package and a NUMA node
+void print_topology() {
+    for (const topology::cpu_info& cpu : topology::cpus()) {
+        std::cout << "cpu " << cpu.cpu << ": core " << cpu.core << ", package " << cpu.package << ", node " << cpu.node << std::endl;
+    }
+}
+
+/// Producer and consumer on two cores of one package, the ring on the NUMA node of the consumer
+void example() {
+    const size_t producer_cpu = 0;
+    const size_t consumer_cpu = topology::find_cpu(producer_cpu, topology::CpuRelation::SAME_PACKAGE).value_or(producer_cpu);
+
+    MmapOptions options;
+    options.numa_node = topology::numa_node_of(consumer_cpu);
+    auto [sender, receiver] = spsc::channel<int>(1 << 20, mmap_allocator<int>(options));
+
+    std::thread producer([&, sender = std::move(sender)]() mutable {
+        topology::pin_thread(producer_cpu);
+        for (int i = 0; i < 1000000; i++) {
+            sender.send(i);
+        }
+    });
+
+    std::thread consumer([&, receiver = std::move(receiver)]() mutable {
+        topology::pin_thread(consumer_cpu);
+        long long sum = 0;
+        int value;
+        while (receiver.receive(value) == ResponseStatus::SUCCESS) {
+            sum += value;
+        }
+        std::cout << "Sum received on cpu " << consumer_cpu << " (node " << options.numa_node << "): " << sum << std::endl;
+    });
+
+    producer.join();
+    consumer.join();
+}
+
+int main() {
+    print_topology();
+    example();
+    return 0;
+}
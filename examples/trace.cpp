@@ -0,0 +1,111 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Tracing Usage Examples
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Trace points are compiled in only when CHANNELS_TRACE is set, usually with -DCHANNELS_TRACE=1
+#define CHANNELS_TRACE 1
+
+#include <spsc.hpp>
+#include <trace.hpp>
+#include <thread>
+#include <vector>
+#include <iostream>
+
+using namespace channels;
+
+/// A fast producer and a slow consumer on a small channel, every send that finds the channel full is recorded
+void example_flight_recorder() {
+    static trace_buffer<1024> recorder;
+    recorder.install();
+
+    auto [sender, receiver] = spsc::channel<int, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::ADAPTIVE>(8);
+
+    std::thread producer([sender = std::move(sender)]() mutable {
+        for (int i = 0; i < 64; ++i) {
+            sender.send(i);
+        }
+    });
+
+    std::thread consumer([receiver = std::move(receiver)]() mutable {
+        int value;
+        while (receiver.receive(value) == ResponseStatus::SUCCESS) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+    });
+
+    producer.join();
+    consumer.join();
+    set_trace_hook(nullptr);
+
+    std::vector<trace_record> records;
+    recorder.snapshot(std::back_inserter(records));
+    std::cout << recorder.recorded() << " events recorded, last ones:" << std::endl;
+
+    // A resumed event minus the blocked one before it is how long the call waited
+    uint64_t blocked_at = 0;
+    for (size_t i = records.size() > 8 ? records.size() - 8 : 0; i < records.size(); ++i) {
+        const trace_record& record = records[i];
+        std::cout << "  " << trace_event_name(record.event) << " depth " << record.depth << "/" << record.slots;
+        if (record.event == TraceEvent::SEND_BLOCKED || record.event == TraceEvent::RECEIVE_BLOCKED) {
+            blocked_at = record.timestamp;
+        } else if (blocked_at != 0) {
+            std::cout << ", waited " << (record.timestamp - blocked_at) / 1000 << " us";
+        }
+        std::cout << std::endl;
+    }
+}
+
+/// A custom hook, here counting the sends that had to wait
+void example_custom_hook() {
+    static std::atomic<size_t> stalls{ 0 };
+    set_trace_hook([](const trace_record& record, void*) noexcept {
+        if (record.event == TraceEvent::SEND_BLOCKED) {
+            stalls.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    auto [sender, receiver] = spsc::channel<int, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::YIELD>(4);
+    std::thread consumer([receiver = std::move(receiver)]() mutable {
+        int value;
+        while (receiver.receive(value) == ResponseStatus::SUCCESS) {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    });
+    for (int i = 0; i < 100; ++i) {
+        sender.send(i);
+    }
+    sender.close();
+    consumer.join();
+    set_trace_hook(nullptr);
+
+    std::cout << "Sender stalled " << stalls.load() << " times" << std::endl;
+}
+
+int main() {
+    std::cout << "Flight recorder example:" << std::endl;
+    example_flight_recorder();
+    std::cout << "Custom hook example:" << std::endl;
+    example_custom_hook();
+    return 0;
+}
@@ -0,0 +1,88 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Watch Channel Usage Examples
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <thread>
+#include <watch.hpp>
+#include <iostream>
+
+using namespace channels::watch;
+
+struct Config {
+    int version = 0;
+    double threshold = 0.0;
+};
+
+/// The receiver polls the latest value whenever it wants, the sender never waits for it
+void example() {
+    auto [sender, receiver] = channel<Config>(Config{ 0, 0.5 });
+
+    std::thread t1([&]() {
+        for (int i = 1; i <= 1000; i++) {
+            sender.send(Config{ i, i * 0.5 });
+        }
+    });
+
+    std::thread t2([&]() {
+        int last = 0;
+        while (last < 1000) {
+            const Config& config = receiver.latest();
+            last = config.version;
+        }
+        std::cout << "Latest: version " << last << ", threshold " << receiver.latest().threshold << std::endl;
+    });
+
+    t1.join();
+    t2.join();
+}
+
+/// Waiting for changes, intermediate values published while the receiver is busy are skipped
+void waiting_example() {
+    auto [sender, receiver] = channel<int, channels::WaitStrategy::ATOMIC_WAIT>();
+
+    std::thread t1([&, sender = std::move(sender)]() mutable {
+        for (int i = 1; i <= 5; i++) {
+            sender.send(i);
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+    }); // the sender is closed when the thread finishes
+
+    int value;
+    while (receiver.receive(value) == channels::ResponseStatus::SUCCESS) {
+        std::cout << "Changed to: " << value << std::endl;
+    }
+    std::cout << "Sender closed" << std::endl;
+
+    t1.join();
+}
+
+int main() {
+    std::cout << "---- Basic example ----" << std::endl;
+    example();
+
+    std::cout << "---- Waiting example ----" << std::endl;
+    waiting_example();
+
+    return 0;
+}
@@ -0,0 +1,220 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Pooled allocation for arc_ptr payloads
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+#include <arc_ptr.hpp>
+
+namespace channels {
+
+/// @brief Thread-caching pool of arc_payload<T> blocks
+/// Every thread keeps a private free list, so allocating and releasing a payload on the
+/// same thread touches no shared state. When a thread frees more blocks than it keeps
+/// cached (typical for oneshot channels, which are created on one thread and destroyed
+/// on another) a batch of blocks is handed to a shared lock-free list, from which
+/// starving threads take everything at once.
+/// The shared list is only ever pushed with CAS and emptied with exchange, so it is not
+/// exposed to the ABA problem of a CAS based pop.
+/// Blocks are carved from slabs obtained from the global operator new and are never
+/// returned to it, memory stays at the high-water mark of live payloads.
+/// @note Used by arc_ptr and make_arc for every T for which arc_pooled<T> is true
+template <typename T>
+class arc_pool {
+public:
+    using payload_type = arc_payload<T>;
+
+    /// @brief Number of blocks allocated at once when the pool is exhausted
+    static constexpr size_t slab_blocks = 64;
+
+    /// @brief Number of blocks a thread keeps before handing a batch to the shared list
+    static constexpr size_t max_cached_blocks = 256;
+
+    /// @brief Returns the process-wide pool for T
+    static arc_pool& instance() noexcept {
+        static arc_pool pool;
+        return pool;
+    }
+
+    /// @brief Constructs payload with reference count 1 from args
+    /// @throws std::bad_alloc if memory cannot be allocated, or whatever T's constructor throws
+    template <typename... Args>
+    payload_type* create(Args&&... args) {
+        void* block = allocate();
+        if constexpr (std::is_nothrow_constructible_v<T, Args&&...>) {
+            return new (block) payload_type(__arc_detail::initial_counts, std::in_place, std::forward<Args>(args)...);
+        } else {
+            try {
+                return new (block) payload_type(__arc_detail::initial_counts, std::in_place, std::forward<Args>(args)...);
+            } catch (...) {
+                deallocate(block);
+                throw;
+            }
+        }
+    }
+
+    /// @brief Returns payload block to the calling thread's cache, T must already be destroyed
+    void release(payload_type* payload) noexcept {
+        payload->~payload_type();
+        deallocate(payload);
+    }
+
+    arc_pool(const arc_pool&) = delete;
+    arc_pool& operator=(const arc_pool&) = delete;
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    static constexpr size_t block_alignment = alignof(payload_type) > alignof(FreeBlock) ? alignof(payload_type) : alignof(FreeBlock);
+    static constexpr size_t block_size = ((sizeof(payload_type) > sizeof(FreeBlock) ? sizeof(payload_type) : sizeof(FreeBlock)) + block_alignment - 1) & ~(block_alignment - 1);
+
+    /// @brief Per thread free list, flushed to the shared list when the thread exits
+    /// @note Payloads released after that (held in a static, dropped from another thread_local destructor)
+    /// go straight to the shared list, see cache_destroyed()
+    struct ThreadCache {
+        FreeBlock* head = nullptr;
+        size_t size = 0;
+
+        ~ThreadCache() {
+            cache_destroyed() = true;
+            if (head) {
+                FreeBlock* tail = head;
+                while (tail->next) {
+                    tail = tail->next;
+                }
+                arc_pool::instance().push_shared(head, tail);
+            }
+        }
+    };
+
+    constexpr arc_pool() noexcept = default;
+
+    static ThreadCache& cache() noexcept {
+        static thread_local ThreadCache cache;
+        return cache;
+    }
+
+    /// @brief Set once the calling thread's cache was destroyed, trivially destructible so it outlives it
+    static bool& cache_destroyed() noexcept {
+        static thread_local bool destroyed = false;
+        return destroyed;
+    }
+
+    void* allocate() {
+        if (cache_destroyed()) [[ unlikely ]] {
+            return allocate_uncached();
+        }
+        ThreadCache& local = cache();
+        if (local.head == nullptr) [[ unlikely ]] {
+            refill(local);
+        }
+        FreeBlock* block = local.head;
+        local.head = block->next;
+        local.size--;
+        return block;
+    }
+
+    void deallocate(void* ptr) noexcept {
+        if (cache_destroyed()) [[ unlikely ]] {
+            FreeBlock* block = new (ptr) FreeBlock{nullptr};
+            push_shared(block, block);
+            return;
+        }
+        ThreadCache& local = cache();
+        FreeBlock* block = new (ptr) FreeBlock{local.head};
+        local.head = block;
+        if (++local.size > max_cached_blocks) [[ unlikely ]] {
+            // hand the oldest half over to the shared list, keep the hot blocks
+            FreeBlock* last_kept = local.head;
+            for (size_t i = 1; i < max_cached_blocks / 2; i++) {
+                last_kept = last_kept->next;
+            }
+            FreeBlock* first = last_kept->next;
+            last_kept->next = nullptr;
+            FreeBlock* tail = first;
+            while (tail->next) {
+                tail = tail->next;
+            }
+            local.size = max_cached_blocks / 2;
+            push_shared(first, tail);
+        }
+    }
+
+    /// @brief Takes the whole shared list, or a fresh slab if it is empty
+    void refill(ThreadCache& local) {
+        FreeBlock* head = shared_.exchange(nullptr, std::memory_order_acquire);
+        if (head == nullptr) {
+            char* slab = static_cast<char*>(::operator new(block_size * slab_blocks, std::align_val_t{block_alignment}));
+            for (size_t i = slab_blocks; i > 0; i--) {
+                head = new (slab + (i - 1) * block_size) FreeBlock{head};
+            }
+            local.head = head;
+            local.size = slab_blocks;
+            return;
+        }
+        size_t size = 0;
+        for (FreeBlock* block = head; block; block = block->next) {
+            size++;
+        }
+        local.head = head;
+        local.size = size;
+    }
+
+    /// @brief Takes one block for a thread whose cache is gone, the rest of the shared list or slab goes back to it
+    void* allocate_uncached() {
+        FreeBlock* head = shared_.exchange(nullptr, std::memory_order_acquire);
+        if (head == nullptr) {
+            char* slab = static_cast<char*>(::operator new(block_size * slab_blocks, std::align_val_t{block_alignment}));
+            for (size_t i = slab_blocks; i > 0; i--) {
+                head = new (slab + (i - 1) * block_size) FreeBlock{head};
+            }
+        }
+        if (FreeBlock* rest = head->next) {
+            FreeBlock* tail = rest;
+            while (tail->next) {
+                tail = tail->next;
+            }
+            push_shared(rest, tail);
+        }
+        return head;
+    }
+
+    void push_shared(FreeBlock* first, FreeBlock* last) noexcept {
+        FreeBlock* top = shared_.load(std::memory_order_relaxed);
+        do {
+            last->next = top;
+        } while (!shared_.compare_exchange_weak(top, first, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    std::atomic<FreeBlock*> shared_{ nullptr };
+};
+
+}
@@ -22,34 +22,171 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <memory>
+#include <new>
 #include <type_traits>
+#include <utility>
 
 namespace channels {
 
+namespace __arc_detail {
+
+/// Strong references are counted in the low half of the counter word and weak references in the high half.
+/// All strong references together hold one weak reference, so T is destroyed by the last strong release
+/// and the block is freed by the last weak release, with the common path still being a single fetch_sub.
+constexpr uint64_t strong_one = 1;
+constexpr uint64_t strong_mask = 0xffffffff;
+constexpr uint64_t weak_one = uint64_t(1) << 32;
+constexpr uint64_t initial_counts = strong_one + weak_one;
+
+/// Set for blocks created by allocate_arc, their deallocator is stored right in front of the payload
+constexpr uint64_t allocated_flag = uint64_t(1) << 63;
+
+}
+
+/// @brief Control block of arc_ptr, reference counts and T in one allocation
+/// T is constructed in place and destroyed separately from the block, so weak_arc can outlive it.
 template <typename T>
 struct arc_payload {
-    std::atomic<size_t> ref_count{1};
-    T data;
+    std::atomic<uint64_t> counts;
+    union {
+        T data;
+    };
+
+    template <typename... Args>
+    explicit arc_payload(uint64_t initial, std::in_place_t, Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args&&...>)
+        : counts(initial), data(std::forward<Args>(args)...) {}
+
+    arc_payload(const arc_payload&) = delete;
+    arc_payload& operator=(const arc_payload&) = delete;
+
+    /// data is destroyed by the last strong reference, see destroy_data
+    ~arc_payload() {}
+};
+
+/// @brief Opt-in trait, when true arc_payload<T> is allocated from arc_pool<T> instead of the heap
+/// @note Specializations must be visible together with arc_pool.hpp wherever arc_ptr<T> is used
+template <typename T>
+struct arc_pooled : std::false_type {};
+
+template <typename T>
+class arc_pool;
+
+template <typename T>
+class weak_arc;
+
+namespace __arc_detail {
+
+using deallocate_fn = void (*)(void* payload) noexcept;
+
+/// @brief Block layout of allocate_arc, [allocator, deallocator][payload]
+/// Deallocator sits right in front of the payload so it can be found without knowing Allocator.
+template <typename T, typename Allocator>
+struct allocation {
+    using payload_type = arc_payload<T>;
+
+    static constexpr size_t header_size = sizeof(Allocator) + sizeof(deallocate_fn);
+    static constexpr size_t payload_offset = (header_size + alignof(payload_type) - 1) / alignof(payload_type) * alignof(payload_type);
+    static constexpr size_t block_alignment = alignof(payload_type) > alignof(Allocator) ? alignof(payload_type) : alignof(Allocator);
+
+    struct alignas(block_alignment) block {
+        unsigned char bytes[payload_offset + sizeof(payload_type)];
+    };
+
+    using block_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<block>;
+    using traits = std::allocator_traits<block_allocator>;
+
+    template <typename... Args>
+    static payload_type* create(const Allocator& alloc, Args&&... args) {
+        block_allocator block_alloc(alloc);
+        block* storage = traits::allocate(block_alloc, 1);
+        payload_type* payload;
+        try {
+            payload = new (storage->bytes + payload_offset) payload_type(initial_counts | allocated_flag, std::in_place, std::forward<Args>(args)...);
+        } catch (...) {
+            traits::deallocate(block_alloc, storage, 1);
+            throw;
+        }
+        new (storage->bytes) block_allocator(std::move(block_alloc));
+        new (storage->bytes + payload_offset - sizeof(deallocate_fn)) deallocate_fn(&deallocate);
+        return payload;
+    }
+
+    static void deallocate(void* ptr) noexcept {
+        payload_type* payload = static_cast<payload_type*>(ptr);
+        payload->~payload_type();
+        block* storage = reinterpret_cast<block*>(reinterpret_cast<unsigned char*>(payload) - payload_offset);
+        block_allocator* stored = std::launder(reinterpret_cast<block_allocator*>(storage->bytes));
+        block_allocator block_alloc(std::move(*stored));
+        stored->~block_allocator();
+        traits::deallocate(block_alloc, storage, 1);
+    }
 };
 
+template <typename T, typename... Args>
+arc_payload<T>* create_payload(Args&&... args) {
+    if constexpr (arc_pooled<T>::value) {
+        return arc_pool<T>::instance().create(std::forward<Args>(args)...);
+    } else {
+        return new arc_payload<T>(initial_counts, std::in_place, std::forward<Args>(args)...);
+    }
+}
+
+template <typename T>
+void destroy_data(arc_payload<T>* payload) noexcept(std::is_nothrow_destructible_v<T>) {
+    payload->data.~T();
+}
+
+/// @brief Frees the block, data must already be destroyed
+template <typename T>
+void free_payload(arc_payload<T>* payload) noexcept {
+    if (payload->counts.load(std::memory_order_relaxed) & allocated_flag) {
+        unsigned char* bytes = reinterpret_cast<unsigned char*>(payload);
+        (*std::launder(reinterpret_cast<deallocate_fn*>(bytes - sizeof(deallocate_fn))))(payload);
+    } else if constexpr (arc_pooled<T>::value) {
+        arc_pool<T>::instance().release(payload);
+    } else {
+        delete payload;
+    }
+}
+
+/// @brief Drops one weak reference, frees the block if it was the last one
+template <typename T>
+void release_weak(arc_payload<T>* payload) noexcept {
+    if ((payload->counts.fetch_sub(weak_one, std::memory_order_acq_rel) & ~allocated_flag) == weak_one) {
+        free_payload(payload);
+    }
+}
+
+}
+
 /// @brief Atomic reference counted smart pointer
 /// It is a lightweight alternative to std::shared_ptr with a focus on performance.
-/// It keeps T object and its reference count in a single control block.
+/// It keeps T object and its reference counts in a single control block, with one atomic word for both strong and weak counts.
+/// @note At most 2^32 - 1 strong and 2^31 - 1 weak references can exist at once
 template<typename T>
 class arc_ptr {
 
 public:
     arc_ptr() noexcept : inner(nullptr) {}
-    arc_ptr(const T& value) : inner(new arc_payload<T>{1, value}) {}
-    arc_ptr(T&& value) : inner(new arc_payload<T>{1, std::move(value)}) {}
+    arc_ptr(const T& value) : inner(__arc_detail::create_payload<T>(value)) {}
+    arc_ptr(T&& value) : inner(__arc_detail::create_payload<T>(std::move(value))) {}
+
+    /// @brief Constructs T in place from args, works for types that can be neither copied nor moved
+    template <typename... Args>
+    explicit arc_ptr(std::in_place_t, Args&&... args) : inner(__arc_detail::create_payload<T>(std::forward<Args>(args)...)) {}
+
+    /// @brief Adopts payload with its reference already counted
+    /// @note For pooled T the payload must come from arc_pool<T>
     arc_ptr(arc_payload<T>* payload) noexcept : inner(payload) {}
 
     arc_ptr(const arc_ptr& other) noexcept : inner(other.inner) {
         if (inner) {
-            inner->ref_count.fetch_add(1, std::memory_order_relaxed);
+            inner->counts.fetch_add(__arc_detail::strong_one, std::memory_order_relaxed);
         }
     }
 
@@ -58,7 +195,7 @@ public:
             release();
             inner = other.inner;
             if (inner) {
-                inner->ref_count.fetch_add(1, std::memory_order_relaxed);
+                inner->counts.fetch_add(__arc_detail::strong_one, std::memory_order_relaxed);
             }
         }
         return *this;
@@ -107,26 +244,126 @@ public:
     }
 
     inline size_t use_count() const noexcept {
-        return inner ? inner->ref_count.load(std::memory_order_relaxed) : 0;
+        return inner ? inner->counts.load(std::memory_order_relaxed) & __arc_detail::strong_mask : 0;
     }
 
 private:
+    friend class weak_arc<T>;
+
     arc_payload<T> *inner;
 
     void release() noexcept(std::is_nothrow_destructible_v<T>) {
         if (inner) {
-            if (inner->ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
-                delete inner;
+            const uint64_t counts = inner->counts.fetch_sub(__arc_detail::strong_one, std::memory_order_acq_rel);
+            if ((counts & __arc_detail::strong_mask) == 1) {
+                __arc_detail::destroy_data(inner);
+                // without weak references nobody else can reach the block, skip the second atomic
+                if ((counts & ~__arc_detail::allocated_flag) == __arc_detail::initial_counts) {
+                    __arc_detail::free_payload(inner);
+                } else {
+                    __arc_detail::release_weak(inner);
+                }
+            }
+            inner = nullptr;
+        }
+    }
+};
+
+/// @brief Non-owning reference to an arc_ptr payload
+/// It keeps the block alive but not T, so holder can check whether all arc_ptr are gone (for example
+/// a sender checking for its receiver) without keeping T alive. Shares the counter word with arc_ptr.
+template <typename T>
+class weak_arc {
+public:
+    weak_arc() noexcept : inner(nullptr) {}
+
+    weak_arc(const arc_ptr<T>& strong) noexcept : inner(strong.inner) {
+        if (inner) {
+            inner->counts.fetch_add(__arc_detail::weak_one, std::memory_order_relaxed);
+        }
+    }
+
+    weak_arc(const weak_arc& other) noexcept : inner(other.inner) {
+        if (inner) {
+            inner->counts.fetch_add(__arc_detail::weak_one, std::memory_order_relaxed);
+        }
+    }
+
+    weak_arc& operator=(const weak_arc& other) noexcept {
+        if (this != &other) {
+            release();
+            inner = other.inner;
+            if (inner) {
+                inner->counts.fetch_add(__arc_detail::weak_one, std::memory_order_relaxed);
+            }
+        }
+        return *this;
+    }
+
+    weak_arc(weak_arc&& other) noexcept : inner(other.inner) {
+        other.inner = nullptr;
+    }
+
+    weak_arc& operator=(weak_arc&& other) noexcept {
+        if (this != &other) {
+            release();
+            inner = other.inner;
+            other.inner = nullptr;
+        }
+        return *this;
+    }
+
+    ~weak_arc() noexcept {
+        release();
+    }
+
+    /// @brief Returns true if there are no arc_ptr left and T was destroyed
+    inline bool expired() const noexcept {
+        return use_count() == 0;
+    }
+
+    /// @brief Takes a strong reference if T is still alive
+    /// @return arc_ptr to T or empty arc_ptr if it expired
+    arc_ptr<T> lock() const noexcept {
+        if (!inner) {
+            return arc_ptr<T>();
+        }
+        uint64_t counts = inner->counts.load(std::memory_order_relaxed);
+        while ((counts & __arc_detail::strong_mask) != 0) {
+            if (inner->counts.compare_exchange_weak(counts, counts + __arc_detail::strong_one, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return arc_ptr<T>(inner);
             }
+        }
+        return arc_ptr<T>();
+    }
+
+    inline size_t use_count() const noexcept {
+        return inner ? inner->counts.load(std::memory_order_acquire) & __arc_detail::strong_mask : 0;
+    }
+
+private:
+    arc_payload<T> *inner;
+
+    void release() noexcept {
+        if (inner) {
+            __arc_detail::release_weak(inner);
             inner = nullptr;
         }
     }
 };
 
+/// @brief Creates T in place together with its reference count
 template<typename T, typename... Args>
 arc_ptr<T> make_arc(Args&&... args) {
-    arc_payload<T>* payload = new arc_payload<T>{1, T(std::forward<Args>(args)...)};
-    return arc_ptr<T>(payload);
+    return arc_ptr<T>(__arc_detail::create_payload<T>(std::forward<Args>(args)...));
+}
+
+/// @brief Like make_arc but the block (counter, T and a deallocator pointer) comes from alloc
+/// @param alloc Allocator, rebound to the block type, a copy of it is kept in the block until it is freed
+/// @note Goes around arc_pool even for pooled T
+template<typename T, typename Allocator, typename... Args>
+arc_ptr<T> allocate_arc(const Allocator& alloc, Args&&... args) {
+    return arc_ptr<T>(__arc_detail::allocation<T, Allocator>::create(alloc, std::forward<Args>(args)...));
 }
 
 }
\ No newline at end of file
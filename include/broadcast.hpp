@@ -0,0 +1,647 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Broadcast Channel Implementation
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <channels.hpp>
+#include <arc_ptr.hpp>
+
+namespace channels::broadcast {
+
+template<typename T, OverflowStrategy Strategy, WaitStrategy Wait>
+class Sender;
+template<typename T, OverflowStrategy Strategy, WaitStrategy Wait>
+class Receiver;
+template<typename T, OverflowStrategy Strategy, WaitStrategy Wait>
+class InnerChannel;
+
+/// @brief Create a bounded single-producer, multi-consumer broadcast channel
+/// @param capacity The minimum capacity of the channel, real capacity will be equal to the closest higher or equal power of two. So for example, if capacity = 12 then channel will hold 16 elements.
+/// @param receivers Number of receivers, every one of them gets every value
+/// @tparam T The type of values sent through the channel
+/// @tparam Strategy WAIT_ON_FULL (default) waits for the slowest receiver, OVERWRITE_ON_FULL and OVERWRITE_SEQUENCED never wait and a lapped receiver skips ahead
+/// @tparam Wait The wait strategy used when looping and trying to send or receive (default: BUSY_LOOP)
+/// @return The sender and one receiver per consumer thread
+/// Every value is written into the ring once, each receiver reads it through its own cursor.
+template <typename T, OverflowStrategy Strategy = OverflowStrategy::WAIT_ON_FULL, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
+std::pair<Sender<T, Strategy, Wait>, std::vector<Receiver<T, Strategy, Wait>>> channel(size_t capacity, size_t receivers) {
+    channels::arc_ptr<InnerChannel<T, Strategy, Wait>> channel = channels::make_arc<InnerChannel<T, Strategy, Wait>>(capacity, receivers);
+    std::vector<Receiver<T, Strategy, Wait>> handles;
+    handles.reserve(receivers);
+    for (size_t i = 0; i < receivers; ++i) {
+        handles.push_back(Receiver<T, Strategy, Wait>(channel, i));
+    }
+    return { Sender<T, Strategy, Wait>(channel), std::move(handles) };
+}
+
+/// @brief Sender for a broadcast channel
+/// @tparam T The type of values sent through the channel
+/// @tparam Strategy The overflow strategy used by the channel
+/// It allows to send values to all receivers. It is designed to be used only from one thread at a time.
+template <typename T, OverflowStrategy Strategy = OverflowStrategy::WAIT_ON_FULL, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
+class Sender {
+    /// Disallows sender creation outside of channel function
+    explicit Sender(channels::arc_ptr<InnerChannel<T, Strategy, Wait>> chan) noexcept : channel_(chan) {}
+public:
+    /// @brief Default constructor
+    /// @note required to have sender as class member
+    Sender() noexcept = default;
+    Sender(const Sender&) = delete;
+    Sender& operator=(const Sender&) = delete;
+
+    Sender& operator=(Sender&& other) noexcept {
+        if (this != &other) {
+            close();
+            channel_ = std::move(other.channel_);
+            other.channel_ = nullptr;
+        }
+        return *this;
+    }
+    Sender(Sender&& other) noexcept : channel_(std::move(other.channel_)) {
+        other.channel_ = nullptr;
+    }
+
+    /// @brief Destructor, closes the sender
+    ~Sender() {
+        close();
+    }
+
+    /// @brief Try to send a value to the channel
+    /// @param value The value to send
+    /// @return SUCCESS, CHANNEL_FULL if the slowest receiver is a whole ring behind, or CHANNEL_CLOSED if all receivers were closed
+    /// @note Overwriting channels never return CHANNEL_FULL
+    /// @note Closed receivers are noticed only on the slow path (the cached free space is used up), once per lap when overwriting
+    template<typename U>
+    ResponseStatus try_send(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&> && std::is_nothrow_assignable_v<T&, U&&>) {
+        return channel_.get_mut()->try_send(std::forward<U>(value));
+    }
+
+    /// @brief Send a value to the channel (copy version)
+    /// @param value The value to send
+    /// @return SUCCESS, or CHANNEL_CLOSED if all receivers were closed
+    /// @note This function is blocking and will wait until the slowest receiver frees the slot.
+    ResponseStatus send(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T> && std::is_nothrow_copy_assignable_v<T>) {
+        ResponseStatus status = channel_.get_mut()->try_send(value);
+        while (status != ResponseStatus::SUCCESS) [[ unlikely ]] {
+            if (status == ResponseStatus::CHANNEL_CLOSED) {
+                return status;
+            }
+            wait_for_space();
+            status = channel_.get_mut()->try_send(value);
+        }
+        return status;
+    }
+
+    /// @brief Send a value to the channel (move version)
+    /// @param value The value to send
+    /// @return SUCCESS, or CHANNEL_CLOSED if all receivers were closed
+    /// @note This function is lock-free but may block if the channel is full.
+    ResponseStatus send(T&& value) noexcept(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>) {
+        ResponseStatus status = channel_.get_mut()->try_send(std::move(value));
+        while (status != ResponseStatus::SUCCESS) [[ unlikely ]] {
+            if (status == ResponseStatus::CHANNEL_CLOSED) {
+                return status;
+            }
+            wait_for_space();
+            status = channel_.get_mut()->try_send(std::move(value));
+        }
+        return status;
+    }
+
+    /// @brief Close the sender and wake up the receivers
+    /// @note The receivers still get the values sent before, then SENDER_CLOSED. The sender is empty afterwards.
+    void close() noexcept {
+        if (channel_) {
+            channel_.get_mut()->close_sender();
+            channel_ = nullptr;
+        }
+    }
+
+    /// @brief Check if all receivers were closed, values sent from now on are never received
+    bool is_closed() const noexcept {
+        return !channel_ || channel_->receivers_closed();
+    }
+
+private:
+    channels::arc_ptr<InnerChannel<T, Strategy, Wait>> channel_;
+
+    /// @brief Wait for the slowest receiver to free some space according to the wait strategy
+    inline void wait_for_space() noexcept {
+        if constexpr (Wait == WaitStrategy::YIELD) {
+            std::this_thread::yield(); // Yield to allow other threads to run
+        } else if constexpr (Wait == WaitStrategy::BUSY_LOOP) {
+            asm volatile ("" ::: "memory"); // Busy loop, just spin with compiler barrier
+        } else if constexpr (Wait == WaitStrategy::ATOMIC_WAIT || Wait == WaitStrategy::ADAPTIVE) {
+            channel_.get_mut()->wait_for_space();
+        }
+    }
+
+    friend std::pair<Sender<T, Strategy, Wait>, std::vector<Receiver<T, Strategy, Wait>>> channel<T, Strategy, Wait>(size_t capacity, size_t receivers);
+};
+
+/// @brief Receiver for a broadcast channel
+/// @tparam T The type of values sent through the channel
+/// @tparam Strategy The overflow strategy used by the channel
+/// It reads every value sent through the channel with its own cursor. It is designed to be used only from one thread at a time.
+template <typename T, OverflowStrategy Strategy = OverflowStrategy::WAIT_ON_FULL, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
+class Receiver {
+    /// Disallows receiver creation outside of channel function
+    explicit Receiver(channels::arc_ptr<InnerChannel<T, Strategy, Wait>> chan, size_t id) noexcept : channel_(chan), id_(id) {}
+public:
+    /// @brief Default constructor
+    /// @note required to have receiver as class member
+    Receiver() noexcept = default;
+    Receiver(const Receiver&) = delete;
+    Receiver& operator=(const Receiver&) = delete;
+
+    Receiver& operator=(Receiver&& other) noexcept {
+        if (this != &other) {
+            close();
+            channel_ = std::move(other.channel_);
+            id_ = other.id_;
+            other.channel_ = nullptr;
+        }
+        return *this;
+    }
+    Receiver(Receiver&& other) noexcept : channel_(std::move(other.channel_)), id_(other.id_) {
+        other.channel_ = nullptr;
+    }
+
+    /// @brief Destructor, closes the receiver
+    ~Receiver() {
+        close();
+    }
+
+    /// @brief Try to receive a value from the channel
+    /// @param value The received value, a copy since other receivers read the same slot
+    /// @return SUCCESS, CHANNEL_EMPTY, or SENDER_CLOSED if the sender was closed and everything was received
+    /// @note This function is lock-free and wait-free
+    ResponseStatus try_receive(T& value) noexcept(std::is_nothrow_copy_assignable_v<T>) {
+        return channel_.get_mut()->try_receive(id_, value);
+    }
+
+    /// @brief Receive a value from the channel
+    /// @return The received value
+    /// @note This function is lock-free but may block if the channel is empty.
+    /// @note If the sender was closed and everything was received a value-initialized T is returned,
+    /// use receive(T&) to tell it apart from a received one.
+    T receive() noexcept(std::is_nothrow_default_constructible_v<T> && std::is_nothrow_copy_assignable_v<T>) {
+        T value{};
+        receive(value);
+        return value;
+    }
+
+    /// @brief Receive a value from the channel
+    /// @param value The received value
+    /// @return SUCCESS, or SENDER_CLOSED if the sender was closed and everything was received
+    /// @note This function is lock-free but may block if the channel is empty.
+    ResponseStatus receive(T& value) noexcept(std::is_nothrow_copy_assignable_v<T>) {
+        ResponseStatus status = channel_.get_mut()->try_receive(id_, value);
+        while (status != ResponseStatus::SUCCESS) [[ unlikely ]] {
+            if (status == ResponseStatus::SENDER_CLOSED) {
+                return status;
+            }
+            wait_for_data();
+            status = channel_.get_mut()->try_receive(id_, value);
+        }
+        return status;
+    }
+
+    /// @brief Receive a value from the channel, waiting for it at most until deadline
+    /// @return SUCCESS, SENDER_CLOSED, or CHANNEL_EMPTY if the deadline has passed
+    /// @note The clock is read only while waiting, so the fast path costs the same as try_receive
+    template <typename Clock, typename Duration>
+    ResponseStatus receive_until(T& value, const std::chrono::time_point<Clock, Duration>& deadline) noexcept(std::is_nothrow_copy_assignable_v<T>) {
+        ResponseStatus status;
+        while ((status = channel_.get_mut()->try_receive(id_, value)) != ResponseStatus::SUCCESS) {
+            if (status == ResponseStatus::SENDER_CLOSED || !channel_.get_mut()->wait_for_data_until(id_, deadline)) {
+                return status;
+            }
+        }
+        return status;
+    }
+
+    /// @brief Receive a value from the channel, waiting for it at most for timeout
+    /// @return SUCCESS, SENDER_CLOSED, or CHANNEL_EMPTY if the time has run out
+    template <typename Rep, typename Period>
+    ResponseStatus receive_for(T& value, const std::chrono::duration<Rep, Period>& timeout) noexcept(std::is_nothrow_copy_assignable_v<T>) {
+        return receive_until(value, std::chrono::steady_clock::now() + timeout);
+    }
+
+    /// @brief Number of values this receiver lost because the sender lapped it
+    /// @note Always 0 with WAIT_ON_FULL
+    uint64_t missed() const noexcept {
+        return channel_ ? channel_->missed(id_) : 0;
+    }
+
+    /// @brief Close the receiver, the sender stops waiting for it
+    /// @note The sender sees CHANNEL_CLOSED once all receivers are closed. The receiver is empty afterwards.
+    void close() noexcept {
+        if (channel_) {
+            channel_.get_mut()->close_receiver(id_);
+            channel_ = nullptr;
+        }
+    }
+
+    /// @brief Check if the sender was closed, values sent before can still be received
+    bool is_closed() const noexcept {
+        return !channel_ || channel_->sender_closed();
+    }
+
+private:
+    channels::arc_ptr<InnerChannel<T, Strategy, Wait>> channel_;
+
+    /// @brief Index of the cursor owned by this receiver
+    size_t id_ = 0;
+
+    /// @brief Wait for the sender to publish a value according to the wait strategy
+    inline void wait_for_data() noexcept {
+        if constexpr (Wait == WaitStrategy::YIELD) {
+            std::this_thread::yield(); // Yield to allow other threads to run
+        } else if constexpr (Wait == WaitStrategy::BUSY_LOOP) {
+            asm volatile ("" ::: "memory"); // Busy loop, just spin with compiler barrier
+        } else if constexpr (Wait == WaitStrategy::ATOMIC_WAIT || Wait == WaitStrategy::ADAPTIVE) {
+            channel_.get_mut()->wait_for_data(id_);
+        }
+    }
+
+    friend std::pair<Sender<T, Strategy, Wait>, std::vector<Receiver<T, Strategy, Wait>>> channel<T, Strategy, Wait>(size_t capacity, size_t receivers);
+};
+
+/// @brief Inner channel implementation for the broadcast channel
+/// @tparam T The type of values sent through the channel
+/// @tparam Strategy The overflow strategy to use when the channel is full
+/// @tparam Wait The wait strategy used for internal operations
+/// This class is not intended to be used directly by users.
+/// Cursors are sequence numbers that only grow, the slot of sequence `n` is `n & capacity_mask_`. The sender
+/// owns one cursor and every receiver owns another one on its own cache line. Like in spsc each side keeps
+/// a cached copy of the cursor it is gated by and refreshes it only when the cache says it has to stop:
+/// receivers cache the sender cursor, the sender caches the slowest receiver cursor.
+/// With WAIT_ON_FULL slot `n` holds a T from the first lap on, the sender assigns over it once every
+/// receiver is past `n - capacity`. Overwriting channels use seqlock stamped slots and never wait.
+/// @note this class should be wrapped in channels::arc_ptr
+template <typename T, OverflowStrategy Strategy = OverflowStrategy::WAIT_ON_FULL, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
+class InnerChannel {
+    static_assert(Wait != WaitStrategy::ASYNC, "ASYNC is supported only by spsc and oneshot channels");
+
+    static constexpr bool overwriting = Strategy != OverflowStrategy::WAIT_ON_FULL;
+    using slot_type = std::conditional_t<overwriting, __sequenced_slot<T>, T>;
+
+    static_assert(!overwriting || std::is_trivially_copyable_v<T>, "overwriting broadcast channels copy values with memcpy, T has to be trivially copyable");
+
+    /// @brief Cursor of a single receiver, together with the state only that receiver touches
+    struct alignas(cache_line_size) Cursor {
+        std::atomic<size_t> sequence{ 0 };
+        size_t sendCursorCache = 0;
+        uint64_t missed = 0;
+    };
+
+public:
+    /// @brief Construct a channel with a given capacity
+    /// @param capacity The minimum capacity of the channel, for performance it will be allocated with next power of 2
+    /// @param receivers Number of receiver cursors
+    /// Uses raw memory allocation so the T type is not required to provide default constructors
+    explicit InnerChannel(size_t capacity, size_t receivers) :
+        capacity_(next_power_of_2(capacity)),
+        capacity_mask_(capacity_ - 1),
+        receivers_(receivers),
+        buffer_(static_cast<slot_type*>(::operator new[](capacity_ * sizeof(slot_type), std::align_val_t{alignof(slot_type)}))),
+        cursors_(std::make_unique<Cursor[]>(receivers)) {
+
+        // Stamps start at 0, which no message ever uses
+        if constexpr (overwriting) {
+            std::uninitialized_value_construct_n(buffer_, capacity_);
+        }
+    }
+
+    InnerChannel(const InnerChannel&) = delete;
+    InnerChannel& operator=(const InnerChannel&) = delete;
+
+    /// This is called when the last sender or receiver handle is dropped
+    ~InnerChannel() {
+        // Every slot written in the last lap still holds its value
+        if constexpr (!overwriting) {
+            const size_t sendCursor = sendCursor_.load(std::memory_order_seq_cst) & ~closed_bit;
+            for (size_t i = sendCursor - std::min(sendCursor, capacity_); i != sendCursor; ++i) {
+                buffer_[i & capacity_mask_].~T();
+            }
+        }
+
+        // Deallocate the buffer
+        ::operator delete[](
+            buffer_,
+            capacity_ * sizeof(slot_type),
+            std::align_val_t{alignof(slot_type)}
+        );
+    }
+
+    /// @brief Try to send a value to the channel
+    /// @param value The value to send
+    /// @return ResponseStatus indicating the result of the operation
+    /// @note This function is lock-free and wait-free
+    template<typename U>
+    ResponseStatus try_send(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&> && std::is_nothrow_assignable_v<T&, U&&>) {
+        if constexpr (overwriting) {
+            return try_send_overwrite(std::forward<U>(value));
+        } else {
+            return try_send_wait_on_full(std::forward<U>(value));
+        }
+    }
+
+    /// @brief Try to receive a value from the channel
+    /// @param id The cursor of the receiver
+    /// @param value The variable to store the received value
+    /// @return ResponseStatus indicating the result of the operation
+    /// @note This function is lock-free and wait-free
+    ResponseStatus try_receive(const size_t id, T& value) noexcept(std::is_nothrow_copy_assignable_v<T>) {
+        Cursor& cursor = cursors_[id];
+        size_t rcvCursor = cursor.sequence.load(std::memory_order_relaxed); // only this receiver writes it
+
+        if constexpr (overwriting) {
+            for (;;) {
+                if (rcvCursor == cursor.sendCursorCache && is_empty(cursor, rcvCursor)) {
+                    return empty_status();
+                }
+
+                if (cursor.sendCursorCache - rcvCursor > capacity_) {
+                    // Lapped, only the last capacity_ messages can still be in the ring
+                    cursor.missed += cursor.sendCursorCache - capacity_ - rcvCursor;
+                    rcvCursor = cursor.sendCursorCache - capacity_;
+                }
+
+                const uint64_t stamp = buffer_[rcvCursor & capacity_mask_].load(&value, rcvCursor);
+                if (stamp == 2 * uint64_t(rcvCursor) + 2) {
+                    cursor.sequence.store(rcvCursor + 1, std::memory_order_relaxed);
+                    return ResponseStatus::SUCCESS;
+                }
+
+                // Message (stamp - 1) / 2 is in this slot now, everything older than its lap is gone
+                const size_t oldest = static_cast<size_t>((stamp - 1) / 2) - capacity_ + 1;
+                cursor.missed += oldest - rcvCursor;
+                rcvCursor = oldest;
+                cursor.sendCursorCache = sendCursor_.load(std::memory_order_acquire) & ~closed_bit;
+            }
+        } else {
+            if (rcvCursor == cursor.sendCursorCache && is_empty(cursor, rcvCursor)) {
+                return empty_status();
+            }
+
+            // Copied, not moved, every other receiver reads the same value
+            value = buffer_[rcvCursor & capacity_mask_];
+            cursor.sequence.store(rcvCursor + 1, std::memory_order_release);
+
+            if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
+                cursor.sequence.notify_one(); // Notify sender that this receiver has moved on
+            } else if constexpr (Wait == WaitStrategy::ADAPTIVE) {
+                parkers_.space.notify_one();
+            }
+
+            return ResponseStatus::SUCCESS;
+        }
+    }
+
+    /// @brief Block until the slowest receiver frees a slot (ATOMIC_WAIT and ADAPTIVE strategies)
+    inline void wait_for_space() noexcept {
+        const size_t sendCursor = sendCursor_.load(std::memory_order_relaxed);
+        size_t rcvCursor;
+        const size_t slowest = slowest_receiver(rcvCursor);
+        if (slowest == receivers_) {
+            return; // every receiver is closed, the next try_send reports it
+        }
+
+        // Waiting on the cursor value seen by the scan, any move of the slowest receiver wakes the sender
+        std::atomic<size_t>& word = cursors_[slowest].sequence;
+        if (sendCursor - rcvCursor >= capacity_) {
+            if constexpr (Wait == WaitStrategy::ADAPTIVE) {
+                parkers_.space.wait(word, rcvCursor);
+            } else {
+                word.wait(rcvCursor, std::memory_order_acquire);
+            }
+        }
+    }
+
+    /// @brief Block until the sender publishes past the cursor of receiver id (ATOMIC_WAIT and ADAPTIVE strategies)
+    inline void wait_for_data(const size_t id) noexcept {
+        const size_t sendCursor = sendCursor_.load(std::memory_order_acquire);
+        if (sendCursor == cursors_[id].sequence.load(std::memory_order_relaxed)) {
+            if constexpr (Wait == WaitStrategy::ADAPTIVE) {
+                parkers_.data.wait(sendCursor_, sendCursor);
+            } else {
+                sendCursor_.wait(sendCursor, std::memory_order_acquire);
+            }
+        }
+    }
+
+    /// @brief Same as wait_for_data, giving up at deadline
+    /// @return false if the deadline has passed with nothing published
+    template <typename Clock, typename Duration>
+    inline bool wait_for_data_until(const size_t id, const std::chrono::time_point<Clock, Duration>& deadline) noexcept {
+        const size_t sendCursor = sendCursor_.load(std::memory_order_acquire);
+        if (sendCursor != cursors_[id].sequence.load(std::memory_order_relaxed)) {
+            return true;
+        }
+        if constexpr (Wait == WaitStrategy::ADAPTIVE) {
+            return parkers_.data.wait_until(sendCursor_, sendCursor, deadline);
+        } else {
+            return __wait_until<Wait>(sendCursor_, sendCursor, deadline);
+        }
+    }
+
+    /// @brief Mark the sender as closed and wake up the receivers
+    /// @note Called by the sender thread, the sender must not use the channel afterwards
+    void close_sender() noexcept {
+        sendCursor_.fetch_or(closed_bit, std::memory_order_release);
+
+        if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
+            sendCursor_.notify_all(); // Notify receivers that the sender is gone
+        } else if constexpr (Wait == WaitStrategy::ADAPTIVE) {
+            parkers_.data.notify_all();
+        }
+    }
+
+    /// @brief Mark receiver id as closed and wake up the sender, it no longer waits for this receiver
+    /// @note Called by the receiver thread, the receiver must not use the channel afterwards
+    void close_receiver(const size_t id) noexcept {
+        std::atomic<size_t>& word = cursors_[id].sequence;
+        word.fetch_or(closed_bit, std::memory_order_release);
+
+        if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
+            word.notify_one(); // Notify sender in case it waits for this receiver
+        } else if constexpr (Wait == WaitStrategy::ADAPTIVE) {
+            parkers_.space.notify_one();
+        }
+    }
+
+    bool sender_closed() const noexcept {
+        return sendCursor_.load(std::memory_order_acquire) & closed_bit;
+    }
+
+    bool receivers_closed() const noexcept {
+        size_t rcvCursor;
+        return slowest_receiver(rcvCursor) == receivers_;
+    }
+
+    uint64_t missed(const size_t id) const noexcept {
+        return cursors_[id].missed;
+    }
+
+private:
+    /// @brief Set in a cursor by its owner when it closes
+    /// Sequences never reach it, a closed receiver cursor is ignored by the sender and the closed sender
+    /// cursor is seen by receivers when they refresh their cache, which keeps close checks off the fast path.
+    static constexpr size_t closed_bit = ~(~size_t(0) >> 1);
+
+    /// @brief Try to send with WAIT_ON_FULL strategy
+    template<typename U>
+    inline ResponseStatus try_send_wait_on_full(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&> && std::is_nothrow_assignable_v<T&, U&&>) {
+        const size_t sendCursor = sendCursor_.load(std::memory_order_relaxed); // only sender thread writes this
+
+        if (sendCursor - rcvCursorCache_ >= capacity_) {
+            // Refresh the cache with the slowest receiver
+            if (slowest_receiver(rcvCursorCache_) == receivers_) return ResponseStatus::CHANNEL_CLOSED;
+            if (sendCursor - rcvCursorCache_ >= capacity_) {
+                return ResponseStatus::CHANNEL_FULL;
+            }
+        }
+
+        // The first lap constructs the values, later laps assign over the value every receiver has read
+        if (sendCursor < capacity_) {
+            new (&buffer_[sendCursor]) T(std::forward<U>(value));
+        } else {
+            buffer_[sendCursor & capacity_mask_] = std::forward<U>(value);
+        }
+
+        sendCursor_.store(sendCursor + 1, std::memory_order_release);
+        notify_receivers();
+        return ResponseStatus::SUCCESS;
+    }
+
+    /// @brief Try to send with an overwriting strategy, never fails unless all receivers are closed
+    /// @note Receiver cursors are not needed to decide anything, they are checked for the closed bit once per lap
+    template<typename U>
+    inline ResponseStatus try_send_overwrite(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&>) {
+        const size_t sendCursor = sendCursor_.load(std::memory_order_relaxed); // only sender thread writes this
+
+        if ((sendCursor & capacity_mask_) == 0 && receivers_closed()) {
+            return ResponseStatus::CHANNEL_CLOSED;
+        }
+
+        if constexpr (std::is_same_v<std::remove_cvref_t<U>, T>) {
+            buffer_[sendCursor & capacity_mask_].store(value, sendCursor);
+        } else {
+            buffer_[sendCursor & capacity_mask_].store(T(std::forward<U>(value)), sendCursor);
+        }
+
+        sendCursor_.store(sendCursor + 1, std::memory_order_release);
+        notify_receivers();
+        return ResponseStatus::SUCCESS;
+    }
+
+    /// @brief Refresh the cached sender cursor of a receiver that caught up with it
+    /// @return true if there is still nothing to receive
+    inline bool is_empty(Cursor& cursor, const size_t rcvCursor) noexcept {
+        cursor.sendCursorCache = sendCursor_.load(std::memory_order_acquire) & ~closed_bit;
+        return rcvCursor == cursor.sendCursorCache;
+    }
+
+    /// @brief Status of a receive that found nothing
+    /// @note Values sent before closing are still received, the sender is reported only once they are
+    inline ResponseStatus empty_status() const noexcept {
+        return sender_closed() ? ResponseStatus::SENDER_CLOSED : ResponseStatus::CHANNEL_EMPTY;
+    }
+
+    /// @brief Find the open receiver furthest behind
+    /// @param slowestCursor Set to the cursor of that receiver
+    /// @return Its index, or receivers_ if all receivers are closed
+    /// @note Every cursor is loaded once, reloading the slowest one could see it pass another receiver
+    inline size_t slowest_receiver(size_t& slowestCursor) const noexcept {
+        size_t slowest = receivers_;
+        slowestCursor = 0;
+        for (size_t i = 0; i < receivers_; ++i) {
+            const size_t rcvCursor = cursors_[i].sequence.load(std::memory_order_acquire);
+            if (!(rcvCursor & closed_bit) && (slowest == receivers_ || rcvCursor < slowestCursor)) {
+                slowest = i;
+                slowestCursor = rcvCursor;
+            }
+        }
+        return slowest;
+    }
+
+    /// @brief Wake up the receivers waiting for the value just published
+    inline void notify_receivers() noexcept {
+        if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
+            sendCursor_.notify_all(); // Notify receivers that a value has been sent
+        } else if constexpr (Wait == WaitStrategy::ADAPTIVE) {
+            parkers_.data.notify_all();
+        }
+    }
+
+    /// @brief Calculate the next power of 2 greater than or equal to n
+    /// @param n The input value
+    /// @return The next power of 2
+    static constexpr size_t next_power_of_2(const size_t n) noexcept {
+        if (n <= 1) return 1;
+
+        // Use bit manipulation for efficiency
+        size_t power = 1;
+        while (power < n) {
+            power <<= 1;
+        }
+        return power;
+    }
+
+    const size_t capacity_;
+    const size_t capacity_mask_; // mask for bitwise index
+    const size_t receivers_;
+    slot_type* buffer_;
+
+    /// @brief One cursor per receiver, each on its own cache line
+    std::unique_ptr<Cursor[]> cursors_;
+
+    /// Sender-side data
+    alignas(cache_line_size) std::atomic<size_t> sendCursor_{ 0 };
+
+    /// @brief Cursor of the slowest receiver seen at the last refresh, touched only by the sender
+    alignas(cache_line_size) size_t rcvCursorCache_ = 0;
+
+    /// Threads parked by the ADAPTIVE strategy
+    [[no_unique_address]] __wait_parkers<Wait> parkers_;
+
+    friend class Sender<T, Strategy, Wait>;
+    friend class Receiver<T, Strategy, Wait>;
+};
+
+} // namespace channels::broadcast
@@ -22,10 +22,84 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <limits>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if CHANNELS_TRACE && __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define CHANNELS_TRACE_USDT 1
+#else
+#define CHANNELS_TRACE_USDT 0
+#endif
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/// @brief Number of pause iterations WaitStrategy::ADAPTIVE spins before it starts yielding
+#ifndef CHANNELS_ADAPTIVE_SPIN_ITERATIONS
+#define CHANNELS_ADAPTIVE_SPIN_ITERATIONS 4096
+#endif
+
+/// @brief Number of yields WaitStrategy::ADAPTIVE makes before it parks the thread
+#ifndef CHANNELS_ADAPTIVE_YIELD_ITERATIONS
+#define CHANNELS_ADAPTIVE_YIELD_ITERATIONS 16
+#endif
+
+/// @brief Rings of at least that many bytes are filled by batch sends of trivially copyable values with non-temporal stores
+/// Set it above the last level cache size, a ring that does not fit there would only evict the receiver data.
+/// 0 (default) always writes through the cache. Non-temporal stores need SSE2, elsewhere they are plain copies.
+#ifndef CHANNELS_STREAMING_STORE_BYTES
+#define CHANNELS_STREAMING_STORE_BYTES 0
+#endif
+
+/// @brief 1 reports the slow paths of blocking sends and receives to the trace hook and to USDT probes, see set_trace_hook
+/// 0 (default) compiles every trace point out. Probes are emitted only if <sys/sdt.h> is available, they are a nop
+/// until a tracer (bpftrace, perf probe) attaches, so a traced build can stay in production.
+#ifndef CHANNELS_TRACE
+#define CHANNELS_TRACE 0
+#endif
+
+/// @brief Granularity of false sharing, every piece of state written by one side is aligned and padded to it
+/// Defaults to std::hardware_destructive_interference_size. Define it as 128 for cpus whose prefetcher pulls
+/// cache lines in adjacent pairs (newer Intel parts), Apple M-series get 128 by default.
+/// @note Both processes of an inter-process channel have to be built with the same value
+#ifndef CHANNELS_CACHE_LINE_SIZE
+#if defined(__APPLE__) && defined(__aarch64__)
+#define CHANNELS_CACHE_LINE_SIZE 128
+#elif defined(__GCC_DESTRUCTIVE_SIZE)
+#define CHANNELS_CACHE_LINE_SIZE __GCC_DESTRUCTIVE_SIZE // same value, without gcc warning about its use in a header
+#elif defined(__cpp_lib_hardware_interference_size)
+#define CHANNELS_CACHE_LINE_SIZE std::hardware_destructive_interference_size
+#else
+#define CHANNELS_CACHE_LINE_SIZE 64
+#endif
+#endif
 
 namespace channels {
 
-constexpr size_t cache_line_size = 64; // Assuming a cache line size of 64 bytes
+constexpr size_t cache_line_size = CHANNELS_CACHE_LINE_SIZE;
+static_assert(cache_line_size >= alignof(std::max_align_t) && (cache_line_size & (cache_line_size - 1)) == 0, "CHANNELS_CACHE_LINE_SIZE has to be a power of two");
 
 /// @brief Overflow strategy for sender when the channel is full
 enum class OverflowStrategy {
@@ -33,7 +107,30 @@ enum class OverflowStrategy {
     WAIT_ON_FULL,
 
     /// @brief Overwrite the oldest unread element
-    OVERWRITE_ON_FULL
+    OVERWRITE_ON_FULL,
+
+    /// @brief Overwrite the oldest unread element, slots are guarded by seqlock stamps instead of a shared flag
+    /// Sends always succeed and receives take no read-modify-write operation, a receiver that was lapped
+    /// skips to the oldest value still in the ring. Requires trivially copyable T, SPSC channels only.
+    OVERWRITE_SEQUENCED
+};
+
+/// @brief Placement of the ring slots of spsc channels relative to cache lines
+/// With small T the sender writing slot i and the receiver reading slot i - 1 share a line, the layouts keep them apart.
+enum class SlotLayout {
+    /// @brief Slots are next to each other (default behavior)
+    PACKED,
+
+    /// @brief Every slot is padded to cache_line_size, so the two sides never touch the same slot line
+    /// @note helps a mostly empty queue of small values, at the cost of cache_line_size bytes per slot
+    /// @note zero-copy peek / reserve are not available, batch operations copy slot by slot
+    PADDED,
+
+    /// @brief The receiver publishes its cursor only once it leaves a whole cache line of slots
+    /// @note the sender never reuses a line the receiver is still reading and the receiver cursor is written
+    /// once per line instead of once per value, up to a line of slots is held back from the sender
+    /// @note WAIT_ON_FULL only, the capacity is raised to at least two lines of slots
+    LINE_RELEASE
 };
 
 /// @brief Wait strategy for receiver and sender when looping and trying
@@ -53,6 +150,480 @@ enum class WaitStrategy {
     /// @note should be used when low latency is required and channel is expected to wait for longer
     /// @note it uses std::atomic_wait under the hood
     ATOMIC_WAIT,
+
+    /// @brief Spin, then yield, then park waiting strategy
+    /// @note should be used when low latency is required but the channel is often idle
+    /// @note it spins with a cpu pause instruction for CHANNELS_ADAPTIVE_SPIN_ITERATIONS, yields for
+    /// CHANNELS_ADAPTIVE_YIELD_ITERATIONS and then parks with std::atomic_wait
+    /// @note the other side issues a wake-up only when a thread is actually parked
+    ADAPTIVE,
+
+    /// @brief Coroutine waiting strategy
+    /// @note should be used when channel is consumed or fed by coroutines
+    /// @note async_send / async_receive suspend the coroutine and the other side resumes it through an executor,
+    /// blocking calls fall back to std::this_thread::yield
+    /// @note supported by spsc and oneshot channels
+    ASYNC,
+};
+
+/// @brief Hint to the cpu that the thread is spinning
+inline void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile ("yield" ::: "memory");
+#else
+    asm volatile ("" ::: "memory");
+#endif
+}
+
+/// @brief Copy bytes with non-temporal stores, they go to memory without filling the caches of the calling thread
+/// The unaligned ends are copied with memcpy, without SSE2 everything is.
+/// @note The stores are weakly ordered, call __stream_fence before publishing them with a release store
+inline void __stream_copy(void* dst, const void* src, size_t bytes) noexcept {
+#if defined(__SSE2__)
+    unsigned char* to = static_cast<unsigned char*>(dst);
+    const unsigned char* from = static_cast<const unsigned char*>(src);
+    const size_t head = std::min(bytes, (16 - reinterpret_cast<uintptr_t>(to) % 16) % 16);
+    std::memcpy(to, from, head);
+    to += head;
+    from += head;
+    bytes -= head;
+    for (; bytes >= 16; bytes -= 16, to += 16, from += 16) {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(to), _mm_loadu_si128(reinterpret_cast<const __m128i*>(from)));
+    }
+    std::memcpy(to, from, bytes);
+#else
+    std::memcpy(dst, src, bytes);
+#endif
+}
+
+/// @brief Order the non-temporal stores of __stream_copy before later stores
+inline void __stream_fence() noexcept {
+#if defined(__SSE2__)
+    _mm_sfence();
+#endif
+}
+
+/// @brief Number of spins between two clock reads of a timed busy wait
+constexpr size_t deadline_check_interval = 64;
+
+/// @brief Minimal futex wrapper used to park threads with an optional deadline
+/// std::atomic::wait has no timed version, so parking goes through the futex syscall on Linux
+/// and falls back to std::atomic::wait and sleeping elsewhere.
+/// @note This namespace is NOT intended to be used directly by the user
+namespace __futex {
+
+/// @brief Block while word holds old or until woken, may return spuriously
+inline void wait(std::atomic<uint32_t>& word, uint32_t old) noexcept {
+#if defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT_PRIVATE, old, nullptr, nullptr, 0);
+#else
+    word.wait(old, std::memory_order_acquire);
+#endif
+}
+
+/// @brief Block while word holds old, until woken or until deadline, may return spuriously
+/// @return false if the deadline has passed
+template <typename Clock, typename Duration>
+bool wait_until(std::atomic<uint32_t>& word, uint32_t old, const std::chrono::time_point<Clock, Duration>& deadline) noexcept {
+    const auto now = Clock::now();
+    if (now >= deadline) {
+        return false;
+    }
+#if defined(__linux__)
+    const auto remaining = std::chrono::ceil<std::chrono::nanoseconds>(deadline - now);
+    timespec timeout{
+        static_cast<time_t>(remaining.count() / 1'000'000'000),
+        static_cast<long>(remaining.count() % 1'000'000'000)
+    };
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT_PRIVATE, old, &timeout, nullptr, 0);
+#else
+    (void)word;
+    (void)old;
+    std::this_thread::sleep_for(std::min<std::chrono::nanoseconds>(deadline - now, std::chrono::microseconds(100)));
+#endif
+    return true;
+}
+
+/// @brief Wake up to count threads blocked on word
+inline void wake(std::atomic<uint32_t>& word, int count) noexcept {
+#if defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+#else
+    if (count == 1) {
+        word.notify_one();
+    } else {
+        word.notify_all();
+    }
+#endif
+}
+
+}
+
+class selector;
+
+/// @brief Registration of a selector in a channel, signalled instead of waking a thread
+/// @note This class is NOT intended to be used directly by the user
+struct __select_hook {
+    void (*signal)(__select_hook* hook) noexcept;
+};
+
+/// @brief Waiter bookkeeping of WaitStrategy::ADAPTIVE
+/// A waiter announces itself before parking and the notifier checks the announcement after
+/// publishing, both separated by a seq_cst fence, so either the waiter sees the new value or
+/// the notifier sees the waiter. Notifiers skip the wake-up syscall while nobody is parked.
+/// A selector (select.hpp) can be armed in the same way, it is signalled instead of woken up.
+/// Threads park on a private 32-bit epoch rather than on the watched word, so the same futex
+/// can be waited on with a deadline.
+/// @note This class is NOT intended to be used directly by the user
+class adaptive_parker {
+public:
+    /// @brief Block until word no longer holds old
+    /// @param parks If given, incremented every time the thread goes to sleep
+    template <typename V>
+    void wait(const std::atomic<V>& word, V old, uint64_t* parks = nullptr) noexcept {
+        if (spin(word, old)) {
+            return;
+        }
+        while (true) {
+            const uint32_t epoch = epoch_.load(std::memory_order_acquire);
+            if (announce(word, old)) {
+                return;
+            }
+            if (parks != nullptr) {
+                ++*parks;
+            }
+            __futex::wait(epoch_, epoch);
+            parked_.fetch_sub(1, std::memory_order_relaxed);
+            if (word.load(std::memory_order_acquire) != old) {
+                return;
+            }
+        }
+    }
+
+    /// @brief Block until word no longer holds old or until deadline
+    /// @param parks If given, incremented every time the thread goes to sleep
+    /// @return false if the deadline has passed while word still holds old
+    template <typename V, typename Clock, typename Duration>
+    bool wait_until(const std::atomic<V>& word, V old, const std::chrono::time_point<Clock, Duration>& deadline, uint64_t* parks = nullptr) noexcept {
+        for (size_t i = 0; i < CHANNELS_ADAPTIVE_SPIN_ITERATIONS; i++) {
+            if (word.load(std::memory_order_acquire) != old) {
+                return true;
+            }
+            if (i % deadline_check_interval == 0 && Clock::now() >= deadline) {
+                return false;
+            }
+            cpu_relax();
+        }
+        for (size_t i = 0; i < CHANNELS_ADAPTIVE_YIELD_ITERATIONS; i++) {
+            if (word.load(std::memory_order_acquire) != old) {
+                return true;
+            }
+            if (Clock::now() >= deadline) {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        while (true) {
+            const uint32_t epoch = epoch_.load(std::memory_order_acquire);
+            if (announce(word, old)) {
+                return true;
+            }
+            if (parks != nullptr) {
+                ++*parks;
+            }
+            const bool in_time = __futex::wait_until(epoch_, epoch, deadline);
+            parked_.fetch_sub(1, std::memory_order_relaxed);
+            if (word.load(std::memory_order_acquire) != old) {
+                return true;
+            }
+            if (!in_time) {
+                return false;
+            }
+        }
+    }
+
+    /// @brief Wake one parked thread, the watched word has to be modified before
+    /// @return true if somebody was woken up (or a selector signalled)
+    bool notify_one() noexcept {
+        return notify(1);
+    }
+
+    /// @brief Wake all parked threads, the watched word has to be modified before
+    /// @return true if somebody was woken up (or a selector signalled)
+    bool notify_all() noexcept {
+        return notify(std::numeric_limits<int>::max());
+    }
+
+    /// @brief Register a selector to be signalled by the next notification unless ready() already holds
+    /// @return true if the selector will be signalled, false if ready() holds and it is not registered
+    /// Same handshake as parking a thread, the hook is taken out of the slot by whoever signals it.
+    template <typename Ready>
+    bool arm(__select_hook* hook, Ready&& ready) noexcept {
+        selector_.store(hook, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (ready()) {
+            // If the notifier has already taken the hook it is signalling the selector
+            return selector_.exchange(nullptr, std::memory_order_acq_rel) != hook;
+        }
+        return true;
+    }
+
+    /// @brief Unregister the selector
+    /// @return false if a notifier has already taken the hook and is signalling it
+    bool disarm() noexcept {
+        return selector_.exchange(nullptr, std::memory_order_acq_rel) != nullptr;
+    }
+
+private:
+    template <typename V>
+    bool spin(const std::atomic<V>& word, V old) noexcept {
+        for (size_t i = 0; i < CHANNELS_ADAPTIVE_SPIN_ITERATIONS; i++) {
+            if (word.load(std::memory_order_acquire) != old) {
+                return true;
+            }
+            cpu_relax();
+        }
+        for (size_t i = 0; i < CHANNELS_ADAPTIVE_YIELD_ITERATIONS; i++) {
+            if (word.load(std::memory_order_acquire) != old) {
+                return true;
+            }
+            std::this_thread::yield();
+        }
+        return false;
+    }
+
+    /// @brief Registers the calling thread as parked unless word has already changed
+    /// @return true if word has changed, the thread is not registered then
+    template <typename V>
+    bool announce(const std::atomic<V>& word, V old) noexcept {
+        parked_.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (word.load(std::memory_order_acquire) != old) {
+            parked_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    inline bool notify(int count) noexcept {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        bool woken = false;
+        if (parked_.load(std::memory_order_relaxed) != 0) [[ unlikely ]] {
+            epoch_.fetch_add(1, std::memory_order_release);
+            __futex::wake(epoch_, count);
+            woken = true;
+        }
+        if (selector_.load(std::memory_order_relaxed) != nullptr) [[ unlikely ]] {
+            if (__select_hook* hook = selector_.exchange(nullptr, std::memory_order_acquire)) {
+                hook->signal(hook);
+                woken = true;
+            }
+        }
+        return woken;
+    }
+
+    std::atomic<uint32_t> parked_{ 0 };
+    std::atomic<uint32_t> epoch_{ 0 };
+    std::atomic<__select_hook*> selector_{ nullptr };
+};
+
+/// @brief Block until word no longer holds old or until deadline, according to the wait strategy
+/// @return false if the deadline has passed while word still holds old
+/// @note ATOMIC_WAIT channels notify through std::atomic::notify_one, which can not be waited on with
+/// a timeout, so timed waits of that strategy sleep with exponential backoff capped at 1ms.
+/// @note This function is NOT intended to be used directly by the user
+template <WaitStrategy Wait, typename V, typename Clock, typename Duration>
+bool __wait_until(const std::atomic<V>& word, V old, const std::chrono::time_point<Clock, Duration>& deadline) noexcept {
+    std::chrono::microseconds backoff{ 1 };
+    for (size_t i = 0; word.load(std::memory_order_acquire) == old; i++) {
+        if constexpr (Wait == WaitStrategy::BUSY_LOOP) {
+            if (i % deadline_check_interval == 0 && Clock::now() >= deadline) {
+                return false;
+            }
+            asm volatile ("" ::: "memory");
+        } else if constexpr (Wait == WaitStrategy::YIELD) {
+            if (Clock::now() >= deadline) {
+                return false;
+            }
+            std::this_thread::yield();
+        } else {
+            const auto now = Clock::now();
+            if (now >= deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::min<std::chrono::nanoseconds>(deadline - now, backoff));
+            backoff = std::min(backoff * 2, std::chrono::microseconds(1000));
+        }
+    }
+    return true;
+}
+
+/// @brief Executor resuming coroutines inline, on the thread that completed the operation
+/// It is the default executor hook of async_send / async_receive
+struct inline_executor {
+    void schedule(std::coroutine_handle<> handle) const noexcept {
+        handle.resume();
+    }
+
+    /// @brief Shared instance used as the default argument of awaitable operations
+    static inline_executor& instance() noexcept {
+        static inline_executor executor;
+        return executor;
+    }
+};
+
+/// @brief Executor hook, anything that can schedule a coroutine to be resumed
+template <typename E>
+concept executor = requires(E& e, std::coroutine_handle<> handle) {
+    { e.schedule(handle) } noexcept;
+};
+
+/// @brief Type erased suspended coroutine together with the executor that resumes it
+/// @note This class is NOT intended to be used directly by the user
+struct __waker {
+    std::coroutine_handle<> handle;
+    void* context;
+    void (*schedule)(void* context, std::coroutine_handle<> handle) noexcept;
+
+    template <executor E>
+    static __waker make(std::coroutine_handle<> handle, E& exec) noexcept {
+        return { handle, &exec, [](void* e, std::coroutine_handle<> h) noexcept { static_cast<E*>(e)->schedule(h); } };
+    }
+
+    inline void wake() const noexcept {
+        schedule(context, handle);
+    }
+};
+
+/// @brief Slot for one suspended coroutine of WaitStrategy::ASYNC
+/// Same handshake as adaptive_parker, the coroutine publishes its waker and rechecks the watched
+/// condition, the notifier checks the slot after publishing, with a seq_cst fence on both sides.
+/// Whoever takes the waker out of the slot decides who resumes the coroutine.
+/// @note This class is NOT intended to be used directly by the user
+class async_parker {
+public:
+    /// @brief Publish waker unless ready() already holds
+    /// @return true if the coroutine stays suspended and will be resumed by the notifier,
+    /// false if it has to continue right away (the result of await_suspend)
+    /// @note ready() runs after the waker is published, it must not touch anything the resumed coroutine may write
+    template <typename Ready>
+    bool park(__waker* waker, Ready&& ready) noexcept {
+        waiter_.store(waker, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (ready()) {
+            // If the notifier has already taken the waker it is resuming the coroutine
+            return waiter_.exchange(nullptr, std::memory_order_acq_rel) != waker;
+        }
+        return true;
+    }
+
+    /// @brief Resume the suspended coroutine if there is one, the watched word has to be modified before
+    /// @return true if a coroutine was resumed (or scheduled)
+    bool notify_one() noexcept {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiter_.load(std::memory_order_relaxed) != nullptr) [[ unlikely ]] {
+            if (__waker* waker = waiter_.exchange(nullptr, std::memory_order_acquire)) {
+                waker->wake();
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    std::atomic<__waker*> waiter_{ nullptr };
+};
+
+/// @brief Parker of a single waiting side, empty unless the channel uses WaitStrategy::ADAPTIVE or ASYNC
+/// @note This class is NOT intended to be used directly by the user
+struct __no_parker {};
+
+template <WaitStrategy Wait>
+using __wait_parker = std::conditional_t<Wait == WaitStrategy::ADAPTIVE, adaptive_parker,
+                      std::conditional_t<Wait == WaitStrategy::ASYNC, async_parker, __no_parker>>;
+
+/// @brief Parkers of both sides of a channel, empty unless the channel uses WaitStrategy::ADAPTIVE or ASYNC
+/// @note This class is NOT intended to be used directly by the user
+template <WaitStrategy Wait>
+struct __wait_parkers {};
+
+/// @note Kept on its own cache line, it is written only when a thread parks
+template <>
+struct alignas(cache_line_size) __wait_parkers<WaitStrategy::ADAPTIVE> {
+    adaptive_parker data;  // receivers waiting for values
+    adaptive_parker space; // senders waiting for free slots
+};
+
+/// @note Kept on its own cache line, it is written only when a coroutine suspends
+template <>
+struct alignas(cache_line_size) __wait_parkers<WaitStrategy::ASYNC> {
+    async_parker data;  // receiver waiting for values
+    async_parker space; // sender waiting for free slots
+};
+
+/// @brief Ring slot of OVERWRITE_SEQUENCED spsc channels and overwriting broadcast channels
+/// The value is kept as relaxed atomic words guarded by a seqlock stamp, so a receiver racing with an
+/// overwrite reads a torn copy instead of invoking a data race, and throws it away because the stamp moved.
+/// Stamp is 2n+1 while message n is written and 2n+2 once it is complete, 0 for a slot never written.
+template <typename T>
+struct __sequenced_slot {
+    static constexpr size_t words = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    std::atomic<uint64_t> stamp;
+    std::atomic<uint64_t> data[words];
+
+    /// @brief Write message n, called by the sender only
+    inline void store(const T& value, const uint64_t n) noexcept {
+        uint64_t copy[words] = {};
+        std::memcpy(copy, &value, sizeof(T));
+        // release so a receiver seeing the odd stamp also sees the cursor of the previous message
+        stamp.store(2 * n + 1, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < words; i++) {
+            data[i].store(copy[i], std::memory_order_relaxed);
+        }
+        stamp.store(2 * n + 2, std::memory_order_release);
+    }
+
+    /// @brief Write message n if no newer message got the slot first, safe with several writers
+    /// @return False if another writer is writing the slot or already wrote a newer message, nothing is written then
+    inline bool try_store(const T& value, const uint64_t n) noexcept {
+        uint64_t current = stamp.load(std::memory_order_relaxed);
+        do {
+            if ((current & 1) || current >= 2 * n + 1) {
+                return false;
+            }
+        } while (!stamp.compare_exchange_weak(current, 2 * n + 1, std::memory_order_relaxed, std::memory_order_relaxed));
+        uint64_t copy[words] = {};
+        std::memcpy(copy, &value, sizeof(T));
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < words; i++) {
+            data[i].store(copy[i], std::memory_order_relaxed);
+        }
+        stamp.store(2 * n + 2, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Copy message n into out if it is still in the slot
+    /// @return Stamp of the slot, the copy is valid only if it equals 2n+2
+    inline uint64_t load(void* out, const uint64_t n) const noexcept {
+        const uint64_t before = stamp.load(std::memory_order_acquire);
+        if (before != 2 * n + 2) {
+            return before;
+        }
+        uint64_t copy[words];
+        for (size_t i = 0; i < words; i++) {
+            copy[i] = data[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const uint64_t after = stamp.load(std::memory_order_relaxed);
+        if (after == before) {
+            std::memcpy(out, copy, sizeof(T));
+        }
+        return after;
+    }
 };
 
 /// @brief Response status for channel operations
@@ -78,6 +649,191 @@ enum class ResponseStatus {
     SENDER_CLOSED
 };
 
+/// @brief Slow path events reported in CHANNELS_TRACE builds
+enum class TraceEvent : uint8_t {
+    SEND_BLOCKED,       // blocking send found no free slot and starts waiting
+    SEND_RESUMED,       // blocking send stopped waiting, it sent the value or the receiver was closed
+    RECEIVE_BLOCKED,    // blocking receive found no value and starts waiting
+    RECEIVE_RESUMED,    // blocking receive stopped waiting, it got a value or the sender was closed
+};
+
+/// @brief Event passed to the trace hook
+/// Cursors are loaded without synchronization when the event happens, the depth is a snapshot and may be
+/// off by the values moved in the meantime. A RESUMED event minus the BLOCKED one before it is the stall.
+struct trace_record {
+    uint64_t timestamp;     // steady_clock time in nanoseconds
+    const void* channel;    // identifies the channel, the same for both of its sides
+    TraceEvent event;
+    ResponseStatus status;  // last status of the blocked call, SUCCESS or a closed status for RESUMED events
+    uint64_t depth;         // values in the channel
+    uint64_t slots;         // slots of the ring
+};
+
+/// @brief Called from the thread that hit the slow path, it must not block and must not use the channel
+using trace_hook = void (*)(const trace_record& record, void* context) noexcept;
+
+namespace __trace {
+
+struct installed_hook {
+    std::atomic<trace_hook> hook{ nullptr };
+    std::atomic<void*> context{ nullptr };
+};
+
+inline installed_hook installed;
+
+/// @brief Report one event to the USDT probe and the installed hook, called only from blocking calls
+inline void emit(const TraceEvent event, const void* channel, const ResponseStatus status, const uint64_t depth, const uint64_t slots) noexcept {
+#if CHANNELS_TRACE_USDT
+    // Probe names have to be literals, one probe per event
+    switch (event) {
+        case TraceEvent::SEND_BLOCKED: DTRACE_PROBE4(channels, send_blocked, channel, int(status), depth, slots); break;
+        case TraceEvent::SEND_RESUMED: DTRACE_PROBE4(channels, send_resumed, channel, int(status), depth, slots); break;
+        case TraceEvent::RECEIVE_BLOCKED: DTRACE_PROBE4(channels, receive_blocked, channel, int(status), depth, slots); break;
+        case TraceEvent::RECEIVE_RESUMED: DTRACE_PROBE4(channels, receive_resumed, channel, int(status), depth, slots); break;
+    }
+#endif
+    const trace_hook hook = installed.hook.load(std::memory_order_acquire);
+    if (hook != nullptr) {
+        const auto now = std::chrono::steady_clock::now().time_since_epoch();
+        const trace_record record{ static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count()),
+                                   channel, event, status, depth, slots };
+        hook(record, installed.context.load(std::memory_order_relaxed));
+    }
+}
+
+}
+
+/// @brief Install the function every trace event of CHANNELS_TRACE builds is passed to, nullptr removes it
+/// @param hook Function called with each event
+/// @param context Passed to hook as is
+/// @note One hook for the whole process. Replacing it while channels are blocking may pass the new context to the old hook,
+/// install it before the channels are used.
+inline void set_trace_hook(trace_hook hook, void* context = nullptr) noexcept {
+    __trace::installed.context.store(context, std::memory_order_relaxed);
+    __trace::installed.hook.store(hook, std::memory_order_release);
+}
+
+/// @brief Snapshot of the counters kept by atomic_stats
+/// Wakeups are counted by the side that issues them and only when somebody was actually parked
+/// (ADAPTIVE and ASYNC), parks only by ADAPTIVE.
+struct channel_stats {
+    uint64_t sends = 0;
+    uint64_t receives = 0;
+    uint64_t full = 0;            // sends rejected with CHANNEL_FULL
+    uint64_t empty = 0;           // receives that found the channel empty
+    uint64_t overwrites = 0;      // values dropped by OVERWRITE_ON_FULL or skipped by an OVERWRITE_SEQUENCED receiver
+    uint64_t skips = 0;           // sends and receives rejected with SKIP_DUE_TO_OVERWRITE
+    uint64_t send_waits = 0;      // wait loop iterations of blocking sends
+    uint64_t receive_waits = 0;   // wait loop iterations of blocking receives
+    uint64_t sender_parks = 0;
+    uint64_t receiver_parks = 0;
+    uint64_t sender_wakeups = 0;  // sender woken up by the receiver
+    uint64_t receiver_wakeups = 0; // receiver woken up by the sender
+    uint64_t max_depth = 0;       // high-water mark of values in the channel, as seen by the sender
+};
+
+/// @brief Statistics policy that keeps nothing, every hook compiles to nothing
+/// A custom policy has to provide the same members, it is called from the sender thread for
+/// the sender hooks and from the receiver thread for the receiver hooks.
+struct no_stats {
+    static constexpr bool enabled = false;
+
+    // Sender thread
+    inline void sent(uint64_t) noexcept {}
+    inline void full() noexcept {}
+    inline void overwritten() noexcept {}
+    inline void send_skipped() noexcept {}
+    inline void depth(uint64_t) noexcept {}
+    inline void send_waited() noexcept {}
+    inline void sender_parked(uint64_t) noexcept {}
+    inline void woke_receiver() noexcept {}
+
+    // Receiver thread
+    inline void received(uint64_t) noexcept {}
+    inline void empty() noexcept {}
+    inline void receive_skipped() noexcept {}
+    inline void lapped(uint64_t) noexcept {}
+    inline void receive_waited() noexcept {}
+    inline void receiver_parked(uint64_t) noexcept {}
+    inline void woke_sender() noexcept {}
+};
+
+/// @brief Statistics policy counting channel events
+/// Each side writes only its own counters, kept on their own cache line, with plain relaxed
+/// stores instead of read-modify-write operations. snapshot() may be called from any thread,
+/// it only loads the counters, so a metrics thread does not slow down the hot path beyond
+/// pulling the cache lines.
+class atomic_stats {
+public:
+    static constexpr bool enabled = true;
+
+    inline void sent(uint64_t n) noexcept { bump(sender_.sends, n); }
+    inline void full() noexcept { bump(sender_.full, 1); }
+    inline void overwritten() noexcept { bump(sender_.overwrites, 1); }
+    inline void send_skipped() noexcept { bump(sender_.skips, 1); }
+    inline void depth(uint64_t depth) noexcept {
+        if (depth > sender_.max_depth.load(std::memory_order_relaxed)) {
+            sender_.max_depth.store(depth, std::memory_order_relaxed);
+        }
+    }
+    inline void send_waited() noexcept { bump(sender_.waits, 1); }
+    inline void sender_parked(uint64_t n) noexcept { bump(sender_.parks, n); }
+    inline void woke_receiver() noexcept { bump(sender_.wakeups, 1); }
+
+    inline void received(uint64_t n) noexcept { bump(receiver_.receives, n); }
+    inline void empty() noexcept { bump(receiver_.empty, 1); }
+    inline void receive_skipped() noexcept { bump(receiver_.skips, 1); }
+    inline void lapped(uint64_t n) noexcept { bump(receiver_.lapped, n); }
+    inline void receive_waited() noexcept { bump(receiver_.waits, 1); }
+    inline void receiver_parked(uint64_t n) noexcept { bump(receiver_.parks, n); }
+    inline void woke_sender() noexcept { bump(receiver_.wakeups, 1); }
+
+    /// @brief Read all counters, the values of the two sides are not taken at the same instant
+    channel_stats snapshot() const noexcept {
+        channel_stats stats;
+        stats.sends = sender_.sends.load(std::memory_order_relaxed);
+        stats.full = sender_.full.load(std::memory_order_relaxed);
+        stats.overwrites = sender_.overwrites.load(std::memory_order_relaxed) + receiver_.lapped.load(std::memory_order_relaxed);
+        stats.send_waits = sender_.waits.load(std::memory_order_relaxed);
+        stats.sender_parks = sender_.parks.load(std::memory_order_relaxed);
+        stats.receiver_wakeups = sender_.wakeups.load(std::memory_order_relaxed);
+        stats.max_depth = sender_.max_depth.load(std::memory_order_relaxed);
+        stats.receives = receiver_.receives.load(std::memory_order_relaxed);
+        stats.empty = receiver_.empty.load(std::memory_order_relaxed);
+        stats.skips = sender_.skips.load(std::memory_order_relaxed) + receiver_.skips.load(std::memory_order_relaxed);
+        stats.receive_waits = receiver_.waits.load(std::memory_order_relaxed);
+        stats.receiver_parks = receiver_.parks.load(std::memory_order_relaxed);
+        stats.sender_wakeups = receiver_.wakeups.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+private:
+    /// @brief Single writer increment, no lock prefix needed
+    static inline void bump(std::atomic<uint64_t>& counter, uint64_t n) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+
+    struct alignas(cache_line_size) SenderSide {
+        std::atomic<uint64_t> sends{ 0 };
+        std::atomic<uint64_t> full{ 0 };
+        std::atomic<uint64_t> overwrites{ 0 };
+        std::atomic<uint64_t> skips{ 0 };
+        std::atomic<uint64_t> waits{ 0 };
+        std::atomic<uint64_t> parks{ 0 };
+        std::atomic<uint64_t> wakeups{ 0 };
+        std::atomic<uint64_t> max_depth{ 0 };
+    } sender_;
+
+    struct alignas(cache_line_size) ReceiverSide {
+        std::atomic<uint64_t> receives{ 0 };
+        std::atomic<uint64_t> empty{ 0 };
+        std::atomic<uint64_t> skips{ 0 };
+        std::atomic<uint64_t> lapped{ 0 };
+        std::atomic<uint64_t> waits{ 0 };
+        std::atomic<uint64_t> parks{ 0 };
+        std::atomic<uint64_t> wakeups{ 0 };
+    } receiver_;
+};
 
 /// @brief RAII-style allocation guard similar to libc++'s
 /// @tparam __alloc 
@@ -0,0 +1,196 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Memory Mapped Allocator Implementation
+ *
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#endif
+
+namespace channels {
+
+/// @brief Options for memory mapped allocations
+struct MmapOptions {
+    /// @brief Back the memory with huge pages
+    /// @note On Linux it tries MAP_HUGETLB first and falls back to transparent huge pages with madvise.
+    /// @note On other systems regular pages are used.
+    bool huge_pages = true;
+
+    /// @brief Touch all pages at allocation time so the first accesses do not take page faults
+    bool prefault = true;
+
+    /// @brief Lock the pages in memory with mlock so they are never swapped out
+    /// @note If locking fails (for example because of RLIMIT_MEMLOCK) memory is still returned, just not locked.
+    bool lock = false;
+
+    /// @brief NUMA node the pages are placed on, -1 leaves it to the kernel (first touch)
+    /// @note On Linux the mapping is bound with mbind(MPOL_PREFERRED) before it is touched, so the pages come from
+    /// that node while it has free memory. On other systems it is ignored.
+    /// @note Pass the node of the consumer, e.g. `topology::numa_node_of(consumer_cpu)`, it reads every slot
+    int numa_node = -1;
+};
+
+/// @brief Allocator that maps memory directly with mmap, optionally with huge pages, prefaulting and mlock
+/// @tparam T The type of allocated objects
+/// It is meant for big ring buffers where TLB misses and first-touch page faults show up in profiles.
+/// It can be used with any channel that takes an allocator, e.g. `channels::spsc::channel<T>(capacity, mmap_allocator<T>())`.
+/// @note Allocations smaller than a page (like the control block of the channel) are served by the default heap
+/// @note memory returned by mmap is page aligned so T can not be aligned to more than a page
+template <typename T>
+class mmap_allocator {
+public:
+    using value_type = T;
+
+    static constexpr size_t huge_page_size = 2 * 1024 * 1024;
+
+    mmap_allocator() noexcept = default;
+    explicit mmap_allocator(const MmapOptions& options) noexcept : options_(options) {}
+
+    template <typename U>
+    mmap_allocator(const mmap_allocator<U>& other) noexcept : options_(other.options()) {}
+
+    T* allocate(size_t n) {
+        const size_t bytes = n * sizeof(T);
+        if (bytes < page_size()) {
+            return std::allocator<T>().allocate(n);
+        }
+
+        const size_t length = mapping_length(bytes);
+        void* memory = MAP_FAILED;
+
+#if defined(__linux__) && defined(MAP_HUGETLB)
+        if (options_.huge_pages) {
+            // Explicit huge pages have to be reserved by the system, it is fine if there are none
+            memory = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | populate_flag(), -1, 0);
+        }
+#endif
+        if (memory == MAP_FAILED) {
+            memory = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | populate_flag(), -1, 0);
+            if (memory == MAP_FAILED) {
+                throw std::bad_alloc();
+            }
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+            if (options_.huge_pages) {
+                // Ask for transparent huge pages instead
+                ::madvise(memory, length, MADV_HUGEPAGE);
+            }
+#endif
+        }
+
+        bind_to_node(memory, length);
+
+        if (options_.prefault && populate_flag() == 0) {
+            // MAP_POPULATE is not available or the pages have to be bound first, they are touched one by one
+            volatile unsigned char* bytesPtr = static_cast<unsigned char*>(memory);
+            for (size_t offset = 0; offset < length; offset += page_size()) {
+                bytesPtr[offset] = 0;
+            }
+        }
+
+        if (options_.lock) {
+            ::mlock(memory, length);
+        }
+
+        return static_cast<T*>(memory);
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept {
+        const size_t bytes = n * sizeof(T);
+        if (bytes < page_size()) {
+            std::allocator<T>().deallocate(ptr, n);
+            return;
+        }
+
+        const size_t length = mapping_length(bytes);
+        if (options_.lock) {
+            ::munlock(ptr, length);
+        }
+        ::munmap(ptr, length);
+    }
+
+    inline const MmapOptions& options() const noexcept {
+        return options_;
+    }
+
+    template <typename U>
+    bool operator==(const mmap_allocator<U>& other) const noexcept {
+        return options_.huge_pages == other.options().huge_pages;
+    }
+
+private:
+    MmapOptions options_;
+
+    static inline size_t page_size() noexcept {
+        static const size_t size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        return size;
+    }
+
+    /// @brief Length of the mapping, it has to be the same for allocation and deallocation
+    /// @note with huge pages it is always a multiple of the huge page size, even if huge pages were not available
+    inline size_t mapping_length(const size_t bytes) const noexcept {
+        const size_t granularity = options_.huge_pages ? huge_page_size : page_size();
+        return (bytes + granularity - 1) / granularity * granularity;
+    }
+
+    inline int populate_flag() const noexcept {
+#if defined(__linux__) && defined(MAP_POPULATE)
+        // MAP_POPULATE faults the pages in before mbind could place them
+        return options_.prefault && options_.numa_node < 0 ? MAP_POPULATE : 0;
+#else
+        return 0;
+#endif
+    }
+
+    /// @brief Prefer the NUMA node from the options for the pages of an untouched mapping
+    /// @note mbind is called directly, so libnuma is not needed. If it fails the kernel places the pages on first touch.
+    inline void bind_to_node(void* memory, const size_t length) const noexcept {
+#if defined(__linux__) && defined(SYS_mbind)
+        if (options_.numa_node < 0) {
+            return;
+        }
+        constexpr size_t bits = 8 * sizeof(unsigned long);
+        unsigned long mask[16] = {};
+        const size_t node = static_cast<size_t>(options_.numa_node);
+        if (node >= bits * 16) {
+            return;
+        }
+        mask[node / bits] = 1UL << (node % bits);
+        // The kernel reads one bit less than maxnode says
+        ::syscall(SYS_mbind, memory, length, MPOL_PREFERRED, mask, bits * 16 + 1, 0);
+#else
+        (void)memory;
+        (void)length;
+#endif
+    }
+};
+
+} // namespace channels
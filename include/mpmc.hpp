@@ -0,0 +1,191 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Multi Producer Multi Consumer (MPMC) Channel Implementation
+ *
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+#include <channels.hpp>
+#include <vyukov_ring.hpp>
+#include <arc_ptr.hpp>
+
+namespace channels::mpmc {
+
+
+template<typename T, OverflowStrategy Strategy, WaitStrategy Wait>
+class Sender;
+template<typename T, OverflowStrategy Strategy, WaitStrategy Wait>
+class Receiver;
+
+/// @brief Inner channel implementation for the MPMC queue, see __vyukov_ring
+/// @note This class is not intended to be used directly by users
+template<typename T, OverflowStrategy Strategy = OverflowStrategy::WAIT_ON_FULL, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
+using InnerChannel = __vyukov_ring<T, Strategy, Wait, true>;
+
+/// @brief Create a bounded multi-producer, multi-consumer channel
+/// @param capacity The minimum capacity of the channel, real capacity will be equal to the closest higher or equal power of two (but at least 2). So for example, if capacity = 12 then channel will hold 16 elements.
+/// @tparam T The type of values sent through the channel
+/// @tparam Strategy The overflow strategy (default: WAIT_ON_FULL)
+/// @tparam Wait The wait strategy used when looping and trying to send or receive (default: BUSY_LOOP)
+/// @return A pair of sender and receiver for the channel, both can be copied for every producer and consumer
+template <typename T, OverflowStrategy Strategy = OverflowStrategy::WAIT_ON_FULL, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
+std::pair<Sender<T, Strategy, Wait>, Receiver<T, Strategy, Wait>> channel(size_t capacity) {
+    channels::arc_ptr<InnerChannel<T, Strategy, Wait>> channel = channels::make_arc<InnerChannel<T, Strategy, Wait>>(capacity);
+    return { Sender<T, Strategy, Wait>(channel), Receiver<T, Strategy, Wait>(channel) };
+}
+
+/// @brief Sender for a multi-producer, multi-consumer channel
+/// @tparam T The type of values sent through the channel
+/// @tparam Strategy The overflow strategy used by the channel
+/// It allows to send values to the channel. Single sender should be used only from one thread at a time,
+/// copy it to get another sender for other producer thread.
+template <typename T, OverflowStrategy Strategy = OverflowStrategy::WAIT_ON_FULL, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
+class Sender {
+    /// Disallows sender creation outside of channel function
+    explicit Sender(channels::arc_ptr<InnerChannel<T, Strategy, Wait>> chan) noexcept : channel_(chan) {}
+public:
+    /// @brief Default constructor
+    /// @note required to have sender as class member
+    Sender() noexcept = default;
+    Sender(const Sender&) noexcept = default;
+    Sender& operator=(const Sender&) = default;
+
+    Sender& operator=(Sender&& other) noexcept {
+        channel_ = std::move(other.channel_);
+        return *this;
+    }
+    Sender(Sender&& other) noexcept : channel_(std::move(other.channel_)) {}
+
+    /// @brief Try to send a value to the channel
+    /// @param value The value to send
+    /// @return ResponseStatus indicating the result of the operation
+    template<typename U>
+    ResponseStatus try_send(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&> && std::is_nothrow_destructible_v<T>) {
+        return channel_.get_mut()->try_send(std::forward<U>(value));
+    }
+
+    /// @brief Send a value to the channel (copy version)
+    /// @param value The value to send
+    /// @note This function is blocking and will wait until the value is sent.
+    void send(const T& value) noexcept(std::is_nothrow_constructible_v<T, const T&> && std::is_nothrow_destructible_v<T>) {
+        if (channel_.get_mut()->try_send(value) != ResponseStatus::SUCCESS) [[ unlikely ]] {
+            do {
+                wait_for_space();
+            } while (channel_.get_mut()->try_send(value) != ResponseStatus::SUCCESS);
+        }
+    }
+
+    /// @brief Send a value to the channel (move version)
+    /// @param value The value to send
+    /// @note This function is lock-free but may block if the channel is full.
+    void send(T&& value) noexcept(std::is_nothrow_constructible_v<T, T&&> && std::is_nothrow_destructible_v<T>) {
+        if (channel_.get_mut()->try_send(std::move(value)) != ResponseStatus::SUCCESS) [[ unlikely ]] {
+            do {
+                wait_for_space();
+            } while (channel_.get_mut()->try_send(std::move(value)) != ResponseStatus::SUCCESS);
+        }
+    }
+
+private:
+    channels::arc_ptr<InnerChannel<T, Strategy, Wait>> channel_;
+
+    /// @brief Wait for any receiver to free some space according to the wait strategy
+    inline void wait_for_space() noexcept {
+        if constexpr (Wait == WaitStrategy::YIELD) {
+            std::this_thread::yield(); // Yield to allow other threads to run
+        } else if constexpr (Wait == WaitStrategy::BUSY_LOOP) {
+            asm volatile ("" ::: "memory"); // Busy loop, just spin with compiler barrier
+        } else if constexpr (Wait == WaitStrategy::ATOMIC_WAIT || Wait == WaitStrategy::ADAPTIVE) {
+            channel_.get_mut()->wait_for_space();
+        }
+    }
+
+    friend std::pair<Sender<T, Strategy, Wait>, Receiver<T, Strategy, Wait>> channel<T, Strategy, Wait>(size_t capacity);
+};
+
+/// @brief Receiver for a multi-producer, multi-consumer channel
+/// @tparam T The type of values sent through the channel
+/// @tparam Strategy The overflow strategy used by the channel
+/// It allows to receive values from the channel. Single receiver should be used only from one thread at a time,
+/// copy it to get another receiver for other consumer thread.
+template <typename T, OverflowStrategy Strategy = OverflowStrategy::WAIT_ON_FULL, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
+class Receiver {
+    /// Disallows receiver creation outside of channel function
+    explicit Receiver(channels::arc_ptr<InnerChannel<T, Strategy, Wait>> chan) noexcept : channel_(chan) {}
+public:
+    /// @brief Default constructor
+    /// @note required to have receiver as class member
+    Receiver() noexcept = default;
+    Receiver(const Receiver&) noexcept = default;
+    Receiver& operator=(const Receiver&) = default;
+
+    Receiver& operator=(Receiver&& other) noexcept {
+        channel_ = std::move(other.channel_);
+        return *this;
+    }
+    Receiver(Receiver&& other) noexcept : channel_(std::move(other.channel_)) {}
+
+    /// @brief Try to receive a value from the channel
+    /// @param value The received value
+    /// @return ResponseStatus indicating the result of the operation
+    /// @note This function is lock-free.
+    ResponseStatus try_receive(T& value) noexcept(std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>) {
+        return channel_.get_mut()->try_receive(value);
+    }
+
+    /// @brief Receive a value from the channel
+    /// @return The received value
+    /// @note This function is lock-free but may block if the channel is empty.
+    T receive() noexcept(std::is_nothrow_default_constructible_v<T> && std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>) {
+        T value;
+        if (channel_.get_mut()->try_receive(value) != ResponseStatus::SUCCESS) [[ unlikely ]] {
+            do {
+                wait_for_data();
+            } while (channel_.get_mut()->try_receive(value) != ResponseStatus::SUCCESS);
+        }
+        return value;
+    }
+
+private:
+    channels::arc_ptr<InnerChannel<T, Strategy, Wait>> channel_;
+
+    /// @brief Wait for any sender to publish a value according to the wait strategy
+    inline void wait_for_data() noexcept {
+        if constexpr (Wait == WaitStrategy::YIELD) {
+            std::this_thread::yield(); // Yield to allow other threads to run
+        } else if constexpr (Wait == WaitStrategy::BUSY_LOOP) {
+            asm volatile ("" ::: "memory"); // Busy loop, just spin with compiler barrier
+        } else if constexpr (Wait == WaitStrategy::ATOMIC_WAIT || Wait == WaitStrategy::ADAPTIVE) {
+            channel_.get_mut()->wait_for_data();
+        }
+    }
+
+    friend std::pair<Sender<T, Strategy, Wait>, Receiver<T, Strategy, Wait>> channel<T, Strategy, Wait>(size_t capacity);
+};
+
+} // namespace channels::mpmc
@@ -28,11 +28,13 @@
 #include <atomic>
 #include <memory>
 #include <algorithm>
+#include <coroutine>
 #include <thread>
 #include <type_traits>
 
 #include <channels.hpp>
 #include <arc_ptr.hpp>
+#include <arc_pool.hpp>
 
 namespace channels::oneshot {
 
@@ -43,6 +45,19 @@ class Receiver;
 template<typename T, WaitStrategy Wait>
 class InnerChannel;
 
+} // namespace channels::oneshot
+
+namespace channels {
+
+/// @brief One-shot channels are created and destroyed at a high rate, so their payloads come from arc_pool
+/// @note Explicitly specialize it as std::false_type for a given InnerChannel<T, Wait> to use the heap instead
+template <typename T, WaitStrategy Wait>
+struct arc_pooled<oneshot::InnerChannel<T, Wait>> : std::true_type {};
+
+}
+
+namespace channels::oneshot {
+
 /// @brief Creates a one-shot channel
 /// @tparam T The type of the value sent through the channel
 /// @tparam Wait The wait strategy used by the channel
@@ -60,7 +75,7 @@ std::pair<Sender<T, Wait>, Receiver<T, Wait>> channel() {
 /// It allows to send values through the channel
 template<typename T, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
 class Sender {
-    explicit Sender(channels::arc_ptr<InnerChannel<T, Wait>> channel) noexcept : channel_(channel) {}
+    explicit Sender(channels::arc_ptr<InnerChannel<T, Wait>> channel, size_t generation = 0) noexcept : channel_(channel), generation_(generation) {}
 public:
     Sender() noexcept = default;
     Sender(const Sender&) = delete;
@@ -68,12 +83,14 @@ public:
 
     Sender(Sender&& other) noexcept {
         channel_ = std::move(other.channel_);
+        generation_ = other.generation_;
         other.channel_ = nullptr;
     }
 
     Sender& operator=(Sender&& other) noexcept {
         if (this != &other) {
             channel_ = std::move(other.channel_);
+            generation_ = other.generation_;
             other.channel_ = nullptr;
         }
         return *this;
@@ -82,21 +99,60 @@ public:
     /// @brief Sends a value through the channel
     /// @param value The value to send
     /// @return The status of the send operation (SUCCESS, SENDER_CLOSED)
+    /// @note SENDER_CLOSED is also returned if the channel was reset after this sender was issued
     ResponseStatus send(const T& value) noexcept(std::is_nothrow_constructible_v<T, const T&>) {
-        return channel_.get_mut()->send(value);
+        return channel_.get_mut()->send(generation_, value);
     }
 
     /// @brief Sends a value through the channel
     /// @param value The value to send
     /// @return The status of the send operation (SUCCESS, SENDER_CLOSED)
+    /// @note SENDER_CLOSED is also returned if the channel was reset after this sender was issued
     ResponseStatus send(T&& value) noexcept(std::is_nothrow_constructible_v<T, T&&>) {
-        return channel_.get_mut()->send(std::move(value));
+        return channel_.get_mut()->send(generation_, std::move(value));
     }
 
 private:
     channels::arc_ptr<InnerChannel<T, Wait>> channel_;
 
+    /// @brief Generation of the channel this sender is allowed to send to
+    size_t generation_ = 0;
+
     friend std::pair<Sender<T, Wait>, Receiver<T, Wait>> channel<T, Wait>(void);
+    friend class Receiver<T, Wait>;
+};
+
+/// @brief Awaitable returned by Receiver::async_receive and by co_await on a receiver
+/// @note Receiving a second time is not an error here, it yields a default constructed value
+template <typename T, WaitStrategy Wait, executor E>
+class ReceiveAwaiter {
+public:
+    ReceiveAwaiter(InnerChannel<T, Wait>* channel, E& exec) noexcept(std::is_nothrow_default_constructible_v<T>)
+        : channel_(channel), exec_(&exec) {}
+
+    bool await_ready() noexcept(std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>) {
+        status_ = channel_->try_receive(value_);
+        return status_ != ResponseStatus::CHANNEL_EMPTY;
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle) noexcept {
+        waker_ = __waker::make(handle, *exec_);
+        return channel_->park(&waker_);
+    }
+
+    T await_resume() noexcept(std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>) {
+        while (status_ == ResponseStatus::CHANNEL_EMPTY) [[ unlikely ]] {
+            status_ = channel_->try_receive(value_);
+        }
+        return std::move(value_);
+    }
+
+private:
+    InnerChannel<T, Wait>* channel_;
+    E* exec_;
+    T value_{};
+    __waker waker_{};
+    ResponseStatus status_{ ResponseStatus::CHANNEL_EMPTY };
 };
 
 /// @brief Receiver for a one-shot channel
@@ -137,21 +193,56 @@ public:
     T receive() noexcept(std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>) {
         T value;
         while (channel_.get_mut()->try_receive(value) != ResponseStatus::SUCCESS) {
-            if constexpr (Wait == WaitStrategy::YIELD) {
+            if constexpr (Wait == WaitStrategy::YIELD || Wait == WaitStrategy::ASYNC) {
                 std::this_thread::yield(); // Yield to allow other threads to run
             } else if constexpr (Wait == WaitStrategy::BUSY_LOOP) {
                 asm volatile ("" ::: "memory"); // Busy loop, just spin with compiler barrier
             } else if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
-                channel_.get_mut()->state_.wait(InnerChannel<T, Wait>::NOT_SENT_MASK, std::memory_order_acquire);
+                const size_t state = channel_.get_mut()->state_.load(std::memory_order_acquire);
+                if ((state & InnerChannel<T, Wait>::PHASE_MASK) != InnerChannel<T, Wait>::SENT_MASK) {
+                    channel_.get_mut()->state_.wait(state, std::memory_order_acquire);
+                }
+            } else if constexpr (Wait == WaitStrategy::ADAPTIVE) {
+                const size_t state = channel_.get_mut()->state_.load(std::memory_order_acquire);
+                if ((state & InnerChannel<T, Wait>::PHASE_MASK) != InnerChannel<T, Wait>::SENT_MASK) {
+                    channel_.get_mut()->parker_.wait(channel_.get_mut()->state_, state);
+                }
             }
         }
-        return std::move(value);
+        return value;
+    }
+
+    /// @brief Receives a value from a coroutine, suspending it until the value is sent
+    /// @param exec Executor the coroutine is resumed on once the value is sent
+    /// @return Awaitable yielding the received value
+    /// @note The default inline_executor resumes the coroutine on the sender thread, inside its send call
+    template <executor E = inline_executor>
+    ReceiveAwaiter<T, Wait, E> async_receive(E& exec = inline_executor::instance()) noexcept(std::is_nothrow_default_constructible_v<T>)
+        requires (Wait == WaitStrategy::ASYNC) {
+        return { channel_.get_mut(), exec };
+    }
+
+    /// @brief Same as async_receive() with the inline_executor
+    ReceiveAwaiter<T, Wait, inline_executor> operator co_await() noexcept(std::is_nothrow_default_constructible_v<T>)
+        requires (Wait == WaitStrategy::ASYNC) {
+        return async_receive();
+    }
+
+    /// @brief Rearms the channel for another exchange
+    /// @return Sender for the next exchange, senders issued before are rejected with SENDER_CLOSED
+    /// @note May be called at any time, e.g. to give up on a late response; an unreceived value is destroyed
+    /// and a send of the old generation that is still in flight is either finished first or rejected
+    /// It reuses the channel instead of allocating a new one.
+    /// It is intended for strictly serial request/response flows where one channel serves every round trip.
+    Sender<T, Wait> reset() noexcept {
+        return Sender<T, Wait>(channel_, channel_.get_mut()->reset());
     }
 
 private:
     channels::arc_ptr<InnerChannel<T, Wait>> channel_;
 
     friend std::pair<Sender<T, Wait>, Receiver<T, Wait>> channel<T, Wait>(void);
+    friend class channels::selector;
 };
 
 /// @brief Inner channel implementation for the one-shot channel
@@ -166,25 +257,39 @@ public:
     /// @brief Destructor
     /// @note if value was sent but was not received we need to call its destructor
     ~InnerChannel() noexcept {
-        if (state_.load(std::memory_order_acquire) == InnerChannel<T, Wait>::SENT_MASK) {
+        if ((state_.load(std::memory_order_acquire) & InnerChannel<T, Wait>::PHASE_MASK) == InnerChannel<T, Wait>::SENT_MASK) {
             reinterpret_cast<T*>(value_)->~T();
         }
     }
 
     /// @brief Sends a value through the channel
     /// @tparam U The type of the value being sent
+    /// @param generation The generation the sender was issued for
     /// @param value The value to send
     /// @return The status of the send operation (SUCCESS, SENDER_CLOSED)
     template <typename U>
-    ResponseStatus send(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&>) {
-        if (state_.load(std::memory_order_acquire) != InnerChannel<T, Wait>::NOT_SENT_MASK) {
-            return ResponseStatus::SENDER_CLOSED; // Already sent
+    ResponseStatus send(size_t generation, U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&>) {
+        size_t expected = (generation << InnerChannel<T, Wait>::GENERATION_SHIFT) | InnerChannel<T, Wait>::NOT_SENT_MASK;
+        // Claim the buffer first, a stale sender racing with reset() either fails here or holds reset() off until it is done
+        if (!state_.compare_exchange_strong(expected, expected | InnerChannel<T, Wait>::WRITING_MASK, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return ResponseStatus::SENDER_CLOSED; // Already sent or stale generation
         }
 
-        new (value_) T(std::forward<U>(value));
-        state_.store(InnerChannel<T, Wait>::SENT_MASK, std::memory_order_release); // Mark as sent
+        if constexpr (std::is_nothrow_constructible_v<T, U&&>) {
+            new (value_) T(std::forward<U>(value));
+        } else {
+            try {
+                new (value_) T(std::forward<U>(value));
+            } catch (...) {
+                state_.store(expected, std::memory_order_relaxed); // Nothing was constructed, the exchange stays open
+                throw;
+            }
+        }
+        state_.store(expected | InnerChannel<T, Wait>::SENT_MASK, std::memory_order_release); // Mark as sent
         if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
             state_.notify_one();
+        } else if constexpr (Wait == WaitStrategy::ADAPTIVE || Wait == WaitStrategy::ASYNC) {
+            parker_.notify_one();
         }
         return ResponseStatus::SUCCESS;
     }
@@ -194,30 +299,88 @@ public:
     /// @return The status of the receive operation (SUCCESS, RECEIVER_CLOSED, CHANNEL_EMPTY)
     ResponseStatus try_receive(T& value) noexcept(std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>) {
         const size_t state = state_.load(std::memory_order_acquire);
-        if (state == InnerChannel<T, Wait>::RECEIVED_MASK) {
+        const size_t phase = state & InnerChannel<T, Wait>::PHASE_MASK;
+        if (phase == InnerChannel<T, Wait>::RECEIVED_MASK) {
             return ResponseStatus::RECEIVER_CLOSED; // Already received value
         }
-        if (state == InnerChannel<T, Wait>::NOT_SENT_MASK) {
-            return ResponseStatus::CHANNEL_EMPTY; // No value available
+        if (phase != InnerChannel<T, Wait>::SENT_MASK) {
+            return ResponseStatus::CHANNEL_EMPTY; // No value available or it is being written
         }
         T* valuePtr = reinterpret_cast<T*>(value_);
         value = std::move(*valuePtr);
         valuePtr->~T();
-        state_.store(InnerChannel<T, Wait>::RECEIVED_MASK, std::memory_order_release);
+        state_.store((state & ~InnerChannel<T, Wait>::PHASE_MASK) | InnerChannel<T, Wait>::RECEIVED_MASK, std::memory_order_release);
         return ResponseStatus::SUCCESS;
     }
 
+    /// @brief Moves the channel to the next generation with nothing sent
+    /// @return The new generation
+    /// @note Only the receiver calls it, a sender of the current generation still writing its value is waited out
+    size_t reset() noexcept {
+        size_t state = state_.load(std::memory_order_acquire);
+        while (true) {
+            const size_t phase = state & InnerChannel<T, Wait>::PHASE_MASK;
+            if (phase == InnerChannel<T, Wait>::WRITING_MASK) {
+                std::this_thread::yield(); // The sender is constructing the value, it publishes SENT next
+                state = state_.load(std::memory_order_acquire);
+                continue;
+            }
+            const size_t generation = (state >> InnerChannel<T, Wait>::GENERATION_SHIFT) + 1;
+            if (phase == InnerChannel<T, Wait>::SENT_MASK) {
+                // Only the receiver moves the state on from SENT, so the CAS below cannot fail after this
+                reinterpret_cast<T*>(value_)->~T(); // value was sent but never received
+            }
+            // release pairs with the acquire CAS in send, the next value may reuse the buffer only after the old one was moved out
+            if (state_.compare_exchange_strong(state, generation << InnerChannel<T, Wait>::GENERATION_SHIFT, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return generation;
+            }
+        }
+    }
+
+    /// @brief Checks if the value was sent and not received yet
+    bool ready_to_receive() const noexcept {
+        return (state_.load(std::memory_order_acquire) & InnerChannel<T, Wait>::PHASE_MASK) == InnerChannel<T, Wait>::SENT_MASK;
+    }
+
+    /// @brief Registers a selector to be signalled when the value is sent
+    /// @return false if the value is there already and the selector is not registered
+    bool arm_selector(__select_hook* hook) noexcept requires (Wait == WaitStrategy::ADAPTIVE) {
+        return parker_.arm(hook, [this]() noexcept { return ready_to_receive(); });
+    }
+
+    /// @brief Unregisters the selector
+    /// @return false if the sender is signalling it right now
+    bool disarm_selector() noexcept requires (Wait == WaitStrategy::ADAPTIVE) {
+        return parker_.disarm();
+    }
+
+    /// @brief Suspends the receiving coroutine until the value is sent
+    /// @return false if the value is there already and the coroutine must not suspend
+    bool park(__waker* waker) noexcept requires (Wait == WaitStrategy::ASYNC) {
+        return parker_.park(waker, [this]() noexcept {
+            const size_t phase = state_.load(std::memory_order_acquire) & InnerChannel<T, Wait>::PHASE_MASK;
+            return phase == InnerChannel<T, Wait>::SENT_MASK || phase == InnerChannel<T, Wait>::RECEIVED_MASK;
+        });
+    }
+
 private:
     /// @brief buffer for single value of type T
     /// @note this way we can reduce heap allocations
     alignas(alignof(T)) char value_[sizeof(T)];
 
     /// @brief Current state of the channel
+    /// Lower bits hold the phase of the current exchange, upper bits the generation bumped by every reset
     std::atomic<size_t> state_{ 0 };
 
+    /// @brief Receiver parked by the ADAPTIVE strategy or suspended by ASYNC
+    [[no_unique_address]] __wait_parker<Wait> parker_;
+
+    static constexpr size_t WRITING_MASK = 3;
     static constexpr size_t RECEIVED_MASK = 2;
     static constexpr size_t SENT_MASK = 1;
     static constexpr size_t NOT_SENT_MASK = 0;
+    static constexpr size_t PHASE_MASK = 3;
+    static constexpr size_t GENERATION_SHIFT = 2;
 
     friend class Sender<T, Wait>;
     friend class Receiver<T, Wait>;
@@ -0,0 +1,664 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Pipeline Runtime
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <channels.hpp>
+#include <mpmc.hpp>
+#include <mpsc.hpp>
+#include <spsc.hpp>
+#include <topology.hpp>
+
+/// A pipeline is a graph of stages connected by edges, with the stages run by a work-stealing thread pool.
+/// Edges are spsc or mpsc channels (fan-in), stages are plain functions over batches of values.
+/// A stage is scheduled when its input gets values, runs without blocking until it has nothing to do
+/// and gives its worker back, so a slow stage is simply run more often instead of leaving cores idle.
+/// Backpressure is the WAIT_ON_FULL strategy of the edges: a stage whose output is full stops taking
+/// input until the next stage frees space, which in the end blocks the thread feeding the source.
+
+namespace channels::pipeline {
+
+/// @brief Thread pool with one run queue per worker, idle workers steal from the queues of the others
+/// Run queues are mpmc channels, so stealing is just receiving from another worker queue.
+/// It satisfies the executor concept, coroutines of async channels can be resumed on it as well.
+/// @note The destructor runs the work still queued, then joins the workers
+class thread_pool {
+public:
+    /// @param threads Number of workers
+    /// @param queue_capacity Capacity of the run queue of every worker, scheduling waits while all of them are full
+    /// @param pin Pin worker i to cpu i (modulo the number of cpus), see topology::pin_thread
+    explicit thread_pool(size_t threads = std::max<size_t>(1, std::thread::hardware_concurrency()), size_t queue_capacity = 1024, bool pin = false) {
+        threads = std::max<size_t>(1, threads);
+        queues_.reserve(threads);
+        for (size_t i = 0; i < threads; i++) {
+            queues_.push_back(mpmc::channel<__task, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::BUSY_LOOP>(queue_capacity));
+        }
+        workers_.reserve(threads);
+        for (size_t i = 0; i < threads; i++) {
+            workers_.emplace_back([this, i, pin]() noexcept {
+                if (pin) {
+                    topology::pin_thread(i % std::max<size_t>(1, std::thread::hardware_concurrency()));
+                }
+                work(i);
+            });
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    ~thread_pool() {
+        stop_.store(true, std::memory_order_release);
+        work_.fetch_add(1, std::memory_order_release);
+        parker_.notify_all();
+        for (std::thread& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    /// @brief Run fn(context) on one of the workers
+    /// @note Called from a worker it goes to the queue of that worker, otherwise the queues are picked round robin
+    void submit(void (*fn)(void*) noexcept, void* context) noexcept {
+        const __task task{ fn, context };
+        const size_t count = queues_.size();
+        const size_t first = current_pool_ == this ? current_index_ : next_.fetch_add(1, std::memory_order_relaxed) % count;
+        for (size_t i = 0; ; i++) {
+            if (queues_[(first + i) % count].first.try_send(task) == ResponseStatus::SUCCESS) {
+                break;
+            }
+            if (i % count == count - 1) {
+                // Every queue is full, the workers are draining them
+                std::this_thread::yield();
+            }
+        }
+        work_.fetch_add(1, std::memory_order_release);
+        parker_.notify_one();
+    }
+
+    /// @brief Resume a coroutine on one of the workers
+    void schedule(std::coroutine_handle<> handle) noexcept {
+        submit([](void* address) noexcept { std::coroutine_handle<>::from_address(address).resume(); }, handle.address());
+    }
+
+    /// @brief Number of workers
+    inline size_t size() const noexcept {
+        return workers_.size();
+    }
+
+private:
+    /// @brief Type erased unit of work
+    struct __task {
+        void (*fn)(void*) noexcept;
+        void* context;
+    };
+
+    using queue_type = std::pair<mpmc::Sender<__task, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::BUSY_LOOP>,
+                                 mpmc::Receiver<__task, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::BUSY_LOOP>>;
+
+    /// @brief Worker loop, its own queue first, then the queues of the others, then sleep until something is submitted
+    void work(const size_t index) noexcept {
+        current_pool_ = this;
+        current_index_ = index;
+        const size_t count = queues_.size();
+        __task task;
+        while (true) {
+            const uint32_t work = work_.load(std::memory_order_acquire);
+            bool found = false;
+            for (size_t i = 0; i < count && !found; i++) {
+                found = queues_[(index + i) % count].second.try_receive(task) == ResponseStatus::SUCCESS;
+            }
+            if (found) {
+                task.fn(task.context);
+                continue;
+            }
+            if (stop_.load(std::memory_order_acquire)) {
+                return;
+            }
+            parker_.wait(work_, work);
+        }
+    }
+
+    /// Handles only forward to their channel, sharing them between threads is fine as they are never reassigned
+    std::vector<queue_type> queues_;
+    std::vector<std::thread> workers_;
+    alignas(cache_line_size) std::atomic<size_t> next_{ 0 };
+    /// Bumped on every submit, idle workers sleep on it
+    alignas(cache_line_size) std::atomic<uint32_t> work_{ 0 };
+    std::atomic<bool> stop_{ false };
+    adaptive_parker parker_;
+
+    static inline thread_local thread_pool* current_pool_ = nullptr;
+    static inline thread_local size_t current_index_ = 0;
+};
+
+/// @brief Channel type of an edge
+enum class EdgeKind {
+    /// @brief One producing stage or source
+    SPSC,
+
+    /// @brief Any number of producing stages and sources, they are merged in arrival order
+    MPSC
+};
+
+/// @brief Scheduling options of a stage
+struct stage_options {
+    /// @brief The stage function is called once it has at least that many values, or when its input is closed
+    size_t min_batch = 1;
+
+    /// @brief Maximum number of values passed to one call of the stage function, raised to min_batch if lower
+    size_t max_batch = 64;
+};
+
+class graph;
+
+/// @brief Stage as seen by the scheduler
+/// @note This class is NOT intended to be used directly by the user
+struct __stage {
+    enum : uint32_t {
+        IDLE,       // waits for input or output space
+        SCHEDULED,  // queued in the pool
+        RUNNING,    // running on a worker
+        NOTIFIED,   // running, and something happened since it started
+        DONE        // input closed and drained, output closed
+    };
+
+    void (*step)(__stage* self) noexcept;   // one run of the stage
+    void (*destroy)(__stage* self) noexcept;
+    graph* owner;
+    thread_pool* pool;
+
+    alignas(cache_line_size) std::atomic<uint32_t> state{ IDLE };
+    /// Set when the output was full, cleared by the consumer of the output once it took values
+    alignas(cache_line_size) std::atomic<bool> blocked{ false };
+
+    /// @brief Make sure the stage runs after this call
+    inline void notify() noexcept;
+
+    /// @brief Queue the stage in the pool, it holds a reference to the graph until it has run
+    inline void submit() noexcept;
+
+    /// @brief Pool entry point
+    static inline void run(void* context) noexcept;
+};
+
+/// @brief Shared state of an edge, the channel and the stages on both of its ends
+/// @note This class is NOT intended to be used directly by the user
+template <typename T, EdgeKind Kind>
+struct __edge_state {
+    static constexpr bool spsc_edge = Kind == EdgeKind::SPSC;
+    using sender_type = std::conditional_t<spsc_edge,
+        spsc::Sender<T, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::ADAPTIVE>,
+        mpsc::Sender<T, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::ADAPTIVE>>;
+    using receiver_type = std::conditional_t<spsc_edge,
+        spsc::Receiver<T, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::ADAPTIVE>,
+        mpsc::Receiver<T, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::ADAPTIVE>>;
+
+    explicit __edge_state(size_t capacity) {
+        if constexpr (spsc_edge) {
+            auto [tx, rx] = spsc::channel<T, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::ADAPTIVE>(capacity);
+            sender = std::move(tx);
+            receiver = std::move(rx);
+        } else {
+            auto [tx, rx] = mpsc::channel<T, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::ADAPTIVE>(capacity);
+            sender = std::move(tx);
+            receiver = std::move(rx);
+        }
+    }
+
+    /// @brief Sender for a new producer, an spsc edge has only one
+    /// @throws std::logic_error if an spsc edge gets a second producer
+    sender_type attach_producer(__stage* stage) {
+        if constexpr (spsc_edge) {
+            if (producers.load(std::memory_order_relaxed) != 0) {
+                throw std::logic_error("spsc edge already has a producer");
+            }
+        }
+        producers.fetch_add(1, std::memory_order_relaxed);
+        if (stage != nullptr) {
+            upstream.push_back(stage);
+        }
+        if constexpr (spsc_edge) {
+            return std::move(sender);
+        } else {
+            return sender;
+        }
+    }
+
+    /// @brief Receiver for the consuming stage, every edge has one
+    /// @throws std::logic_error if the edge gets a second consumer
+    receiver_type attach_consumer(__stage* stage) {
+        if (consumer != nullptr) {
+            throw std::logic_error("edge already has a consumer");
+        }
+        consumer = stage;
+        return std::move(receiver);
+    }
+
+    /// @brief A producer will not send anything more, the last one closes the edge
+    void producer_done() noexcept {
+        if (producers.fetch_sub(1, std::memory_order_acq_rel) == 1 && consumer != nullptr) {
+            consumer->notify();
+        }
+    }
+
+    /// @brief Check if every producer is done, values sent before are still in the channel
+    inline bool closed() const noexcept {
+        return producers.load(std::memory_order_acquire) == 0;
+    }
+
+    /// @brief Wake up producing stages stopped by a full channel, called by the consumer after it took values
+    /// @note Pairs with the fence in the producer: it either sees the freed space or the consumer sees its flag
+    void notify_producers() noexcept {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for (__stage* stage : upstream) {
+            if (stage->blocked.load(std::memory_order_relaxed) && stage->blocked.exchange(false, std::memory_order_acq_rel)) {
+                stage->notify();
+            }
+        }
+    }
+
+    sender_type sender;
+    receiver_type receiver;
+    alignas(cache_line_size) std::atomic<size_t> producers{ 0 };
+    __stage* consumer = nullptr;
+    std::vector<__stage*> upstream; // fixed before the graph starts
+};
+
+/// @brief Connection between stages, a bounded channel of values of type T
+/// @tparam T The type of values flowing through the edge
+/// @tparam Kind SPSC (default) for one producer, MPSC to merge several producers
+/// Edges are created by graph::edge and are cheap to copy, all copies refer to the same channel.
+template <typename T, EdgeKind Kind = EdgeKind::SPSC>
+class edge {
+public:
+    using value_type = T;
+    static constexpr EdgeKind kind = Kind;
+
+private:
+    explicit edge(std::shared_ptr<__edge_state<T, Kind>> state) noexcept : state_(std::move(state)) {}
+
+    std::shared_ptr<__edge_state<T, Kind>> state_;
+
+    friend class graph;
+};
+
+/// @brief Handle for a thread outside of the pool feeding an edge
+/// @note send waits according to WAIT_ON_FULL while the edge is full, that is where backpressure ends
+template <typename T, EdgeKind Kind = EdgeKind::SPSC>
+class source {
+    using state_type = __edge_state<T, Kind>;
+public:
+    source(source&& other) noexcept : state_(std::move(other.state_)), sender_(std::move(other.sender_)), owner_(std::exchange(other.owner_, nullptr)) {}
+    source(const source&) = delete;
+    source& operator=(const source&) = delete;
+    source& operator=(source&&) = delete;
+
+    ~source() {
+        close();
+    }
+
+    /// @brief Send a value to the edge, waiting while it is full
+    template <typename U>
+    void send(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&>) {
+        sender_.send(std::forward<U>(value));
+        notify_consumer();
+    }
+
+    /// @brief Try to send a value to the edge
+    /// @return SUCCESS or CHANNEL_FULL
+    template <typename U>
+    ResponseStatus try_send(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&>) {
+        const ResponseStatus status = sender_.try_send(std::forward<U>(value));
+        if (status == ResponseStatus::SUCCESS) {
+            notify_consumer();
+        }
+        return status;
+    }
+
+    /// @brief Tell the pipeline that nothing more will be sent, stages finish once they drained their input
+    /// @note Called by the destructor
+    inline void close() noexcept;
+
+private:
+    source(std::shared_ptr<state_type> state, graph* owner);
+
+    inline void notify_consumer() noexcept {
+        if (state_->consumer != nullptr) {
+            state_->consumer->notify();
+        }
+    }
+
+    std::shared_ptr<state_type> state_;
+    typename state_type::sender_type sender_;
+    graph* owner_;
+
+    friend class graph;
+};
+
+/// @brief Graph of stages run by a thread_pool
+/// Build it first, with edge, source, stage and sink, then start it. It finishes once every source is closed
+/// and every stage drained its input.
+/// @note Stage functions run on pool workers, one call at a time per stage, and must not throw
+class graph {
+public:
+    /// @param pool Pool running the stages, it has to outlive the graph
+    explicit graph(thread_pool& pool) noexcept : pool_(pool) {}
+
+    graph(const graph&) = delete;
+    graph& operator=(const graph&) = delete;
+
+    /// @brief Wait for the pipeline to finish, see wait
+    ~graph() {
+        wait();
+        for (__stage* stage : stages_) {
+            stage->destroy(stage);
+        }
+    }
+
+    /// @brief Create an edge
+    /// @param capacity Minimum capacity of the channel
+    template <typename T, EdgeKind Kind = EdgeKind::SPSC>
+    edge<T, Kind> make_edge(size_t capacity) {
+        return edge<T, Kind>(std::make_shared<__edge_state<T, Kind>>(capacity));
+    }
+
+    /// @brief Create a source feeding an edge from a thread outside of the pool
+    template <typename T, EdgeKind Kind>
+    source<T, Kind> make_source(const edge<T, Kind>& output) {
+        return source<T, Kind>(output.state_, this);
+    }
+
+    /// @brief Add a stage reading one edge and writing another one
+    /// @param fn Called as fn(std::span<In> batch, std::vector<Out>& out), values appended to out are sent downstream.
+    /// A function taking a single In& and returning Out is applied to every value of the batch instead.
+    template <typename In, EdgeKind InKind, typename Out, EdgeKind OutKind, typename F>
+    void stage(const edge<In, InKind>& input, const edge<Out, OutKind>& output, F fn, stage_options options = {}) {
+        add(new __stage_node<In, InKind, Out, OutKind, F>(*this, input.state_, output.state_, std::move(fn), options));
+    }
+
+    /// @brief Add a stage consuming an edge
+    /// @param fn Called as fn(std::span<In> batch), or as fn(In&) for every value
+    template <typename In, EdgeKind InKind, typename F>
+    void sink(const edge<In, InKind>& input, F fn, stage_options options = {}) {
+        add(new __stage_node<In, InKind, void, EdgeKind::SPSC, F>(*this, input.state_, nullptr, std::move(fn), options));
+    }
+
+    /// @brief Start running the stages
+    void start() noexcept {
+        for (__stage* stage : stages_) {
+            stage->notify();
+        }
+    }
+
+    /// @brief Wait until every source is closed and every stage finished
+    void wait() noexcept {
+        uint32_t refs;
+        while ((refs = refs_.load(std::memory_order_acquire)) != 0) {
+            __futex::wait(refs_, refs);
+        }
+    }
+
+private:
+    /// @brief Stage with its input, output and the function transforming one into the other
+    template <typename In, EdgeKind InKind, typename Out, EdgeKind OutKind, typename F>
+    struct __stage_node : __stage {
+        static constexpr bool has_output = !std::is_void_v<Out>;
+        using output_value = std::conditional_t<has_output, Out, char>;
+        using input_state = __edge_state<In, InKind>;
+        using output_state = std::conditional_t<has_output, __edge_state<output_value, OutKind>, void>;
+        using output_sender = std::conditional_t<has_output, typename __edge_state<output_value, OutKind>::sender_type, char>;
+
+        __stage_node(graph& owner_graph, std::shared_ptr<input_state> in, std::shared_ptr<output_state> out, F function, stage_options opts)
+            : input_(std::move(in)), output_(std::move(out)), fn_(std::move(function)),
+              min_batch_(std::max<size_t>(1, opts.min_batch)), max_batch_(std::max(opts.max_batch, min_batch_)) {
+            step = [](__stage* self) noexcept { static_cast<__stage_node*>(self)->run_once(); };
+            destroy = [](__stage* self) noexcept { delete static_cast<__stage_node*>(self); };
+            owner = &owner_graph;
+            pool = &owner_graph.pool_;
+            receiver_ = input_->attach_consumer(this);
+            if constexpr (has_output) {
+                sender_ = output_->attach_producer(this);
+            }
+            batch_.reserve(max_batch_);
+        }
+
+        /// @brief One run, reschedules itself while it has work, goes idle when waiting for input or output space
+        void run_once() noexcept {
+            state.store(RUNNING, std::memory_order_relaxed);
+            // Pairs with the fence in notify(), either the run sees the published input or the notifier sees RUNNING
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const bool again = process();
+
+            if (finished_) {
+                state.store(DONE, std::memory_order_release);
+                owner->release();
+                return;
+            }
+            uint32_t expected = RUNNING;
+            if (again || !state.compare_exchange_strong(expected, IDLE, std::memory_order_acq_rel)) {
+                // More work or notified while running
+                state.store(SCHEDULED, std::memory_order_relaxed);
+                submit();
+            }
+        }
+
+        /// @return true if it should run again
+        bool process() noexcept {
+            if (!flush()) {
+                return false;
+            }
+
+            // Closed has to be seen before the last receive, then every value sent before closing was received
+            const bool closed = input_->closed();
+            bool drained = false;
+            const size_t received = pull(drained);
+            if (received != 0) {
+                input_->notify_producers();
+            }
+
+            if (batch_.size() >= min_batch_ || (closed && drained && !batch_.empty())) {
+                invoke();
+                batch_.clear();
+                if (!flush()) {
+                    return false;
+                }
+                if (!drained) {
+                    return true;
+                }
+            }
+
+            if (closed && drained && batch_.empty()) {
+                if constexpr (has_output) {
+                    output_->producer_done();
+                }
+                finished_ = true;
+            }
+            return false;
+        }
+
+        /// @brief Receive values until the batch is full or the input is empty
+        size_t pull(bool& drained) noexcept {
+            size_t received = 0;
+            In value;
+            while (batch_.size() < max_batch_) {
+                if (receiver_.try_receive(value) != ResponseStatus::SUCCESS) {
+                    drained = true;
+                    break;
+                }
+                batch_.push_back(std::move(value));
+                received++;
+            }
+            return received;
+        }
+
+        inline void invoke() noexcept {
+            const std::span<In> batch(batch_);
+            if constexpr (!has_output) {
+                if constexpr (std::invocable<F&, std::span<In>>) {
+                    fn_(batch);
+                } else {
+                    for (In& value : batch) {
+                        fn_(value);
+                    }
+                }
+            } else if constexpr (std::invocable<F&, std::span<In>, std::vector<Out>&>) {
+                fn_(batch, pending_);
+            } else {
+                for (In& value : batch) {
+                    pending_.push_back(fn_(value));
+                }
+            }
+        }
+
+        /// @brief Send the pending output downstream
+        /// @return false if the output is full, the consumer of the output wakes the stage up once it took values
+        bool flush() noexcept {
+            if constexpr (has_output) {
+                const size_t start = sent_;
+                while (sent_ < pending_.size()) {
+                    if (sender_.try_send(std::move(pending_[sent_])) == ResponseStatus::SUCCESS) {
+                        sent_++;
+                        continue;
+                    }
+                    // Announce the stop, then look at the channel once more, see notify_producers
+                    blocked.store(true, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if (sender_.try_send(std::move(pending_[sent_])) != ResponseStatus::SUCCESS) {
+                        if (sent_ != start) {
+                            output_->consumer->notify();
+                        }
+                        return false;
+                    }
+                    sent_++;
+                }
+                if (sent_ != start) {
+                    output_->consumer->notify();
+                }
+                pending_.clear();
+                sent_ = 0;
+            }
+            return true;
+        }
+
+        std::shared_ptr<input_state> input_;
+        std::shared_ptr<output_state> output_;
+        typename input_state::receiver_type receiver_;
+        output_sender sender_{};
+        F fn_;
+        const size_t min_batch_;
+        const size_t max_batch_;
+        std::vector<In> batch_;
+        std::vector<output_value> pending_; // output not sent yet, from sent_ on
+        size_t sent_ = 0;
+        bool finished_ = false;
+    };
+
+    void add(__stage* stage) {
+        stages_.push_back(stage);
+        acquire(); // released when the stage is done
+    }
+
+    /// @brief Every stage not done yet, open source and queued run holds a reference, wait returns at zero
+    inline void acquire() noexcept {
+        refs_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// @note The graph may be gone right after the last release, only the address of refs_ is used afterwards
+    inline void release() noexcept {
+        if (refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            __futex::wake(refs_, std::numeric_limits<int>::max());
+        }
+    }
+
+    thread_pool& pool_;
+    std::vector<__stage*> stages_;
+    alignas(cache_line_size) std::atomic<uint32_t> refs_{ 0 };
+
+    friend struct __stage;
+    template <typename, EdgeKind> friend class source;
+};
+
+inline void __stage::notify() noexcept {
+    // Orders the channel publish before the state load, pairs with the fence in run_once
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    uint32_t current = state.load(std::memory_order_acquire);
+    while (true) {
+        if (current == IDLE) {
+            if (state.compare_exchange_weak(current, SCHEDULED, std::memory_order_acq_rel)) {
+                submit();
+                return;
+            }
+        } else if (current == RUNNING) {
+            if (state.compare_exchange_weak(current, NOTIFIED, std::memory_order_acq_rel)) {
+                return;
+            }
+        } else {
+            return; // SCHEDULED and NOTIFIED run again anyway, DONE never does
+        }
+    }
+}
+
+inline void __stage::submit() noexcept {
+    owner->acquire();
+    pool->submit(&__stage::run, this);
+}
+
+inline void __stage::run(void* context) noexcept {
+    __stage* self = static_cast<__stage*>(context);
+    graph* const owner = self->owner;
+    self->step(self);
+    owner->release(); // reference of this run, the stage may be gone right after
+}
+
+template <typename T, EdgeKind Kind>
+source<T, Kind>::source(std::shared_ptr<state_type> state, graph* owner) : state_(std::move(state)), owner_(owner) {
+    sender_ = state_->attach_producer(nullptr);
+    owner_->acquire(); // released by close
+}
+
+template <typename T, EdgeKind Kind>
+inline void source<T, Kind>::close() noexcept {
+    if (owner_ == nullptr) {
+        return;
+    }
+    state_->producer_done();
+    std::exchange(owner_, nullptr)->release();
+}
+
+} // namespace channels::pipeline
@@ -0,0 +1,390 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Selecting over multiple receivers
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <channels.hpp>
+#include <spsc.hpp>
+#include <oneshot.hpp>
+
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#include <unistd.h>
+#elif defined(__APPLE__) || defined(__FreeBSD__)
+#include <sys/event.h>
+#include <unistd.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace channels {
+
+/// @brief Pollable file descriptor used to wake up event loops
+/// eventfd on Linux, a kqueue with an EVFILT_USER event on macOS and FreeBSD, a non-blocking pipe elsewhere.
+/// @note This class is NOT intended to be used directly by the user
+class __event_fd {
+public:
+    __event_fd() noexcept {
+#if defined(__linux__)
+        read_fd_ = write_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+#elif defined(__APPLE__) || defined(__FreeBSD__)
+        read_fd_ = write_fd_ = kqueue();
+        if (read_fd_ >= 0) {
+            struct kevent event;
+            EV_SET(&event, 0, EVFILT_USER, EV_ADD | EV_CLEAR, 0, 0, nullptr);
+            if (kevent(read_fd_, &event, 1, nullptr, 0, nullptr) < 0) {
+                ::close(read_fd_);
+                read_fd_ = write_fd_ = -1;
+            }
+        }
+#else
+        int fds[2];
+        if (pipe(fds) == 0) {
+            for (const int fd : fds) {
+                fcntl(fd, F_SETFL, O_NONBLOCK);
+                fcntl(fd, F_SETFD, FD_CLOEXEC);
+            }
+            read_fd_ = fds[0];
+            write_fd_ = fds[1];
+        }
+#endif
+    }
+
+    __event_fd(const __event_fd&) = delete;
+    __event_fd& operator=(const __event_fd&) = delete;
+
+    ~__event_fd() {
+        if (read_fd_ >= 0) {
+            ::close(read_fd_);
+        }
+        if (write_fd_ >= 0 && write_fd_ != read_fd_) {
+            ::close(write_fd_);
+        }
+    }
+
+    /// @brief Descriptor that becomes readable when signalled, -1 if it could not be created
+    inline int fd() const noexcept {
+        return read_fd_;
+    }
+
+    /// @brief Make the descriptor readable
+    void signal() const noexcept {
+#if defined(__linux__)
+        const uint64_t one = 1;
+        [[maybe_unused]] const auto written = ::write(write_fd_, &one, sizeof(one));
+#elif defined(__APPLE__) || defined(__FreeBSD__)
+        struct kevent event;
+        EV_SET(&event, 0, EVFILT_USER, 0, NOTE_TRIGGER, 0, nullptr);
+        kevent(write_fd_, &event, 1, nullptr, 0, nullptr);
+#else
+        const char one = 1;
+        [[maybe_unused]] const auto written = ::write(write_fd_, &one, sizeof(one));
+#endif
+    }
+
+    /// @brief Make the descriptor not readable again
+    void drain() const noexcept {
+#if defined(__linux__)
+        uint64_t count;
+        [[maybe_unused]] const auto read = ::read(read_fd_, &count, sizeof(count));
+#elif defined(__APPLE__) || defined(__FreeBSD__)
+        struct kevent event;
+        const struct timespec no_wait{ 0, 0 };
+        kevent(read_fd_, nullptr, 0, &event, 1, &no_wait); // EV_CLEAR resets the event once it is retrieved
+#else
+        char buffer[64];
+        while (::read(read_fd_, buffer, sizeof(buffer)) > 0) {}
+#endif
+    }
+
+private:
+    int read_fd_ = -1;
+    int write_fd_ = -1;
+};
+
+/// @brief Waits on a set of receivers at once and tells which of them has something to receive
+/// A receiver found empty is armed, its sender signals the selector on the next publish by setting
+/// the receiver's bit in a shared bitmap, so selecting visits only receivers that were signalled
+/// (plus the ones that were ready last time) instead of polling every one of them.
+/// When nothing is ready the selector waits like WaitStrategy::ADAPTIVE, spinning, yielding and
+/// finally parking until one of the senders signals it.
+/// Arming reuses the ADAPTIVE wake-up handshake, so only ADAPTIVE receivers can be added and
+/// senders pay nothing extra while their receiver is not armed.
+/// A pollable selector additionally exposes a file descriptor for epoll / kqueue based event loops,
+/// it becomes readable when an armed receiver is signalled, so only empty to non-empty transitions
+/// cost a syscall on the sender side.
+/// @note A selector and the receivers added to it must be used from a single thread, the receiving one.
+/// A receiver has to stay alive (not closed) while it is added, remove it first.
+class selector {
+public:
+    /// @brief Returned when there is no free slot or no receiver is ready
+    static constexpr size_t npos = ~size_t(0);
+
+    /// @brief Create a selector
+    /// @param capacity Maximum number of receivers added at the same time
+    /// @param pollable Create a file descriptor that is readable while a receiver may be ready, see fd()
+    explicit selector(size_t capacity, bool pollable = false)
+        : capacity_(capacity), words_((capacity + 63) / 64),
+          slots_(std::make_unique<Slot[]>(capacity)),
+          signalled_(std::make_unique<std::atomic<uint64_t>[]>(words_)),
+          pending_(std::make_unique<uint64_t[]>(words_)),
+          event_fd_(pollable ? std::make_unique<__event_fd>() : nullptr) {
+        for (size_t i = 0; i < capacity_; i++) {
+            slots_[i].signal = &selector::signal;
+            slots_[i].owner = this;
+            slots_[i].index = i;
+        }
+    }
+
+    selector(const selector&) = delete;
+    selector& operator=(const selector&) = delete;
+
+    /// @brief Destructor, removes every receiver
+    ~selector() {
+        for (size_t i = 0; i < capacity_; i++) {
+            remove(i);
+        }
+    }
+
+    /// @brief Add an SPSC receiver
+    /// @return Index reported by select when the receiver is ready, npos if the selector is full
+    template <typename T, OverflowStrategy Strategy, typename Allocator, typename Stats, SlotLayout Layout>
+    size_t add(spsc::Receiver<T, Strategy, WaitStrategy::ADAPTIVE, Allocator, Stats, Layout>& receiver) noexcept {
+        return add(receiver.channel_.get());
+    }
+
+    /// @brief Add a oneshot receiver
+    /// @return Index reported by select when the value is sent, npos if the selector is full
+    template <typename T>
+    size_t add(oneshot::Receiver<T, WaitStrategy::ADAPTIVE>& receiver) noexcept {
+        return add(receiver.channel_.get_mut());
+    }
+
+    /// @brief Descriptor to register in an event loop, -1 if the selector is not pollable (or it could not be created)
+    /// Once it is readable call drain_fd() and then try_select() until it returns npos. Receivers are armed
+    /// only by try_select finding them empty, so stopping earlier may miss wake-ups.
+    int fd() const noexcept {
+        return event_fd_ ? event_fd_->fd() : -1;
+    }
+
+    /// @brief Make fd() not readable until the next signal
+    void drain_fd() noexcept {
+        if (event_fd_) {
+            event_fd_->drain();
+            // After the drain, a sender that sets the flag from now on writes again
+            fd_signalled_.exchange(false, std::memory_order_acq_rel);
+        }
+    }
+
+    /// @brief Remove a receiver, its index may be reused by the next add
+    /// @note Waits for a sender that is signalling the receiver right now to finish
+    void remove(size_t index) noexcept {
+        Slot& slot = slots_[index];
+        if (slot.channel == nullptr) {
+            return;
+        }
+        if (slot.disarm(slot.channel)) {
+            slot.idle.store(true, std::memory_order_relaxed);
+        }
+        while (!slot.idle.load(std::memory_order_acquire)) {
+            cpu_relax();
+        }
+        const uint64_t bit = uint64_t(1) << (index % 64);
+        signalled_[index / 64].fetch_and(~bit, std::memory_order_relaxed);
+        pending_[index / 64] &= ~bit;
+        slot.channel = nullptr;
+    }
+
+    /// @brief Find a receiver that has something to receive, without waiting
+    /// @return Its index or npos if none is ready
+    /// @note A returned receiver stays a candidate, it is checked again by the next call, so it is
+    /// fine to receive a single value. Receivers are visited round-robin starting after the last one returned.
+    /// @note A closed SPSC sender keeps its receiver ready, remove it once it reports SENDER_CLOSED
+    size_t try_select() noexcept {
+        for (size_t w = 0; w < words_; w++) {
+            if (signalled_[w].load(std::memory_order_relaxed) != 0) {
+                pending_[w] |= signalled_[w].exchange(0, std::memory_order_acquire);
+            }
+        }
+
+        const size_t first_word = cursor_ / 64;
+        for (size_t step = 0; words_ != 0 && step <= words_; step++) {
+            const size_t w = (first_word + step) % words_;
+            uint64_t candidates = pending_[w];
+            if (step == 0) {
+                candidates &= ~uint64_t(0) << (cursor_ % 64); // bits from the cursor onwards
+            } else if (step == words_) {
+                candidates &= ~(~uint64_t(0) << (cursor_ % 64)); // wrapped around, bits before the cursor
+            }
+            while (candidates != 0) {
+                const size_t bit = std::countr_zero(candidates);
+                candidates &= candidates - 1;
+                const size_t index = w * 64 + bit;
+                if (poll(slots_[index])) {
+                    cursor_ = index + 1 < capacity_ ? index + 1 : 0;
+                    return index;
+                }
+                pending_[w] &= ~(uint64_t(1) << bit);
+            }
+        }
+        return npos;
+    }
+
+    /// @brief Wait until a receiver has something to receive
+    /// @return Its index
+    /// @note Blocks forever if no receiver was added
+    size_t select() noexcept {
+        while (true) {
+            const uint64_t signals = signals_.load(std::memory_order_acquire);
+            const size_t index = try_select();
+            if (index != npos) {
+                return index;
+            }
+            parker_.wait(signals_, signals);
+        }
+    }
+
+    /// @brief Wait until a receiver has something to receive, at most until deadline
+    /// @return Its index, or npos if the deadline has passed
+    template <typename Clock, typename Duration>
+    size_t select_until(const std::chrono::time_point<Clock, Duration>& deadline) noexcept {
+        while (true) {
+            const uint64_t signals = signals_.load(std::memory_order_acquire);
+            const size_t index = try_select();
+            if (index != npos || !parker_.wait_until(signals_, signals, deadline)) {
+                return index;
+            }
+        }
+    }
+
+    /// @brief Wait until a receiver has something to receive, at most for timeout
+    /// @return Its index, or npos if the time has run out
+    template <typename Rep, typename Period>
+    size_t select_for(const std::chrono::duration<Rep, Period>& timeout) noexcept {
+        return select_until(std::chrono::steady_clock::now() + timeout);
+    }
+
+private:
+    /// @brief Receiver registration, the hook armed in its channel
+    struct Slot : __select_hook {
+        selector* owner = nullptr;
+        size_t index = 0;
+
+        /// @brief Type erased channel, nullptr if the slot is free
+        void* channel = nullptr;
+        bool (*ready)(void* channel) noexcept = nullptr;
+        bool (*arm)(void* channel, __select_hook* hook) noexcept = nullptr;
+        bool (*disarm)(void* channel) noexcept = nullptr;
+
+        /// @brief False while the hook may be held by a sender, the slot can not be armed or freed then
+        std::atomic<bool> idle{ true };
+    };
+
+    template <typename Channel>
+    size_t add(Channel* channel) noexcept {
+        for (size_t i = 0; i < capacity_; i++) {
+            Slot& slot = slots_[i];
+            if (slot.channel != nullptr) {
+                continue;
+            }
+            slot.channel = channel;
+            slot.ready = [](void* c) noexcept { return static_cast<Channel*>(c)->ready_to_receive(); };
+            slot.arm = [](void* c, __select_hook* hook) noexcept { return static_cast<Channel*>(c)->arm_selector(hook); };
+            slot.disarm = [](void* c) noexcept { return static_cast<Channel*>(c)->disarm_selector(); };
+            pending_[i / 64] |= uint64_t(1) << (i % 64); // checked and armed by the next select
+            if (event_fd_) {
+                signal_fd(); // make the event loop run that select
+            }
+            return i;
+        }
+        return npos;
+    }
+
+    /// @brief Check a candidate, arm it if it has nothing to receive
+    /// @return true if it is ready
+    bool poll(Slot& slot) noexcept {
+        if (slot.ready(slot.channel)) {
+            return true;
+        }
+        // The previous signal may still be finishing, it sets the bit before it releases the hook
+        while (!slot.idle.load(std::memory_order_acquire)) {
+            cpu_relax();
+        }
+        slot.idle.store(false, std::memory_order_relaxed);
+        if (slot.arm(slot.channel, &slot)) {
+            return false;
+        }
+        slot.idle.store(true, std::memory_order_relaxed);
+        return true;
+    }
+
+    /// @brief Called by a sender that took the hook of an armed receiver
+    static void signal(__select_hook* hook) noexcept {
+        Slot* slot = static_cast<Slot*>(hook);
+        selector* self = slot->owner;
+        self->signalled_[slot->index / 64].fetch_or(uint64_t(1) << (slot->index % 64), std::memory_order_release);
+        self->signals_.fetch_add(1, std::memory_order_release);
+        self->parker_.notify_one();
+        if (self->event_fd_) {
+            self->signal_fd();
+        }
+        slot->idle.store(true, std::memory_order_release); // last access, the selector may be gone afterwards
+    }
+
+    /// @brief Write to the descriptor unless it was written since the last drain_fd
+    inline void signal_fd() noexcept {
+        if (!fd_signalled_.exchange(true, std::memory_order_acq_rel)) {
+            event_fd_->signal();
+        }
+    }
+
+    const size_t capacity_;
+    const size_t words_;
+    std::unique_ptr<Slot[]> slots_;
+
+    /// @brief Bits set by senders
+    std::unique_ptr<std::atomic<uint64_t>[]> signalled_;
+
+    /// @brief Receivers to check by the next select, only the selecting thread touches it
+    std::unique_ptr<uint64_t[]> pending_;
+    size_t cursor_ = 0;
+
+    /// @brief Bumped by every signal, the selecting thread waits on it
+    alignas(cache_line_size) std::atomic<uint64_t> signals_{ 0 };
+    adaptive_parker parker_;
+    std::atomic<bool> fd_signalled_{ false };
+
+    const std::unique_ptr<__event_fd> event_fd_;
+};
+
+} // namespace channels
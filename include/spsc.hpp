@@ -35,6 +35,13 @@
 #include <atomic>
 #include <memory>
 #include <algorithm>
+#include <bit>
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <span>
 #include <thread>
 #include <type_traits>
 
@@ -43,33 +50,179 @@
 namespace channels::spsc {
 
 
-template<typename T, OverflowStrategy Strategy, WaitStrategy Wait>
+template<typename T, OverflowStrategy Strategy, WaitStrategy Wait, typename Allocator, typename Stats, SlotLayout Layout>
 class Sender;
-template<typename T, OverflowStrategy Strategy, WaitStrategy Wait>
+template<typename T, OverflowStrategy Strategy, WaitStrategy Wait, typename Allocator, typename Stats, SlotLayout Layout>
 class Receiver;
-template<typename T, OverflowStrategy Strategy, WaitStrategy Wait>
+template<typename T, OverflowStrategy Strategy, WaitStrategy Wait, typename Allocator, typename Stats, SlotLayout Layout>
 class InnerChannel;
+template<typename T, size_t N, OverflowStrategy Strategy, WaitStrategy Wait, typename Stats, SlotLayout Layout>
+class static_channel;
+
+/// @brief Tag passed as the Allocator of a spsc channel to store its ring of N slots inline, see static_channel
+/// @tparam N Number of slots, a power of two
+template <size_t N>
+struct static_storage {};
+
+/// @brief Number of slots of T released together by SlotLayout::LINE_RELEASE, a power of two
+template <typename T>
+inline constexpr size_t __slots_per_line = sizeof(T) >= cache_line_size ? 1 : std::bit_floor(cache_line_size / sizeof(T));
+
+/// @brief View over a run of consecutive ring slots
+/// @tparam T The type of values stored in the slots
+/// The run can wrap around the end of the ring so it is represented as two spans.
+/// `second` is empty unless the run wraps.
+template <typename T>
+struct RingSpan {
+    std::span<T> first;
+    std::span<T> second;
+
+    inline size_t size() const noexcept {
+        return first.size() + second.size();
+    }
+
+    inline bool empty() const noexcept {
+        return first.empty();
+    }
+
+    inline T& operator[](const size_t i) const noexcept {
+        return i < first.size() ? first[i] : second[i - first.size()];
+    }
+};
 
 /// @brief Create a bounded single-producer, single-consumer channel
-/// @param capacity The minimum capacity of the channel, real capacity will be equal to the closest higher or equal power of two - 1. So for example, if capacity = 12 then channel will hold 15 elements.
+/// @param capacity The minimum capacity of the channel, real capacity will be equal to the closest higher or equal power of two - 1. So for example, if capacity = 12 then channel will hold 15 elements. With OVERWRITE_SEQUENCED all slots are used, so it holds 16.
+/// @param alloc Allocator used for both the ring buffer and the shared control block (default: std::allocator<T>)
 /// @tparam T The type of values sent through the channel
 /// @tparam Strategy The overflow strategy (default: WAIT_ON_FULL)
 /// @tparam Wait The wait strategy used when looping and trying to send or receive (default: BUSY_LOOP)
+/// @tparam Allocator The allocator type, it is rebound to the type it has to allocate
+/// @tparam Stats Statistics policy, no_stats (default) or atomic_stats, see stats()
+/// @tparam Layout Placement of the slots relative to cache lines (default: PACKED), see SlotLayout
 /// @return A pair of sender and receiver for the channel
-template <typename T, OverflowStrategy Strategy = OverflowStrategy::WAIT_ON_FULL, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
-std::pair<Sender<T, Strategy, Wait>, Receiver<T, Strategy, Wait>> channel(size_t capacity) {
-    auto channel = std::make_shared<InnerChannel<T, Strategy, Wait>>(capacity);
-    return { Sender<T, Strategy, Wait>(channel), Receiver<T, Strategy, Wait>(channel) };
+template <typename T, OverflowStrategy Strategy = OverflowStrategy::WAIT_ON_FULL, WaitStrategy Wait = WaitStrategy::BUSY_LOOP, typename Allocator = std::allocator<T>, typename Stats = no_stats, SlotLayout Layout = SlotLayout::PACKED>
+std::pair<Sender<T, Strategy, Wait, Allocator, Stats, Layout>, Receiver<T, Strategy, Wait, Allocator, Stats, Layout>> channel(size_t capacity, const Allocator& alloc = Allocator()) {
+    auto channel = std::allocate_shared<InnerChannel<T, Strategy, Wait, Allocator, Stats, Layout>>(alloc, capacity, alloc);
+    return { Sender<T, Strategy, Wait, Allocator, Stats, Layout>(channel), Receiver<T, Strategy, Wait, Allocator, Stats, Layout>(channel) };
 }
 
+/// @brief Single-producer, single-consumer channel with its capacity fixed at compile time and its ring stored inline
+/// @tparam T The type of values sent through the channel
+/// @tparam N Number of slots, a power of two. Like channel() it holds N - 1 elements, N with OVERWRITE_SEQUENCED.
+/// @tparam Strategy The overflow strategy (default: WAIT_ON_FULL)
+/// @tparam Wait The wait strategy used when looping and trying to send or receive (default: BUSY_LOOP)
+/// @tparam Stats Statistics policy, no_stats (default) or atomic_stats
+/// @tparam Layout Placement of the slots relative to cache lines (default: PACKED), LINE_RELEASE needs N of at least two lines of slots
+/// Nothing is allocated, neither the ring nor a control block, so it can live in static storage or on the stack.
+/// With the capacity a constant the index mask is an immediate and the ring sits next to the cursors.
+/// @note The channel has to outlive the sender and the receiver obtained from split()
+template <typename T, size_t N, OverflowStrategy Strategy = OverflowStrategy::WAIT_ON_FULL, WaitStrategy Wait = WaitStrategy::BUSY_LOOP, typename Stats = no_stats, SlotLayout Layout = SlotLayout::PACKED>
+class static_channel {
+    static_assert(Layout != SlotLayout::LINE_RELEASE || N >= 2 * __slots_per_line<T>, "SlotLayout::LINE_RELEASE needs N of at least two lines of slots");
+public:
+    using sender_type = Sender<T, Strategy, Wait, static_storage<N>, Stats, Layout>;
+    using receiver_type = Receiver<T, Strategy, Wait, static_storage<N>, Stats, Layout>;
+
+    static_channel() = default;
+    static_channel(const static_channel&) = delete;
+    static_channel& operator=(const static_channel&) = delete;
+
+    /// @brief Get the sender and the receiver of the channel
+    /// @note Call it once, the handles do not own the channel
+    std::pair<sender_type, receiver_type> split() noexcept {
+        // Aliasing constructor with an empty owner, the handles point at the inline channel without a control block
+        std::shared_ptr<InnerChannel<T, Strategy, Wait, static_storage<N>, Stats, Layout>> channel(std::shared_ptr<void>(), &channel_);
+        return { sender_type(channel), receiver_type(channel) };
+    }
+
+private:
+    InnerChannel<T, Strategy, Wait, static_storage<N>, Stats, Layout> channel_{ N };
+};
+
+/// @brief Awaitable returned by Sender::async_send
+/// The value is moved into the awaiter, so the awaiter can outlive the expression it was created in.
+/// @note Resuming through the executor happens-after the slot was freed, so the retry in await_resume succeeds
+template <typename T, OverflowStrategy Strategy, WaitStrategy Wait, typename Allocator, typename Stats, SlotLayout Layout, executor E>
+class SendAwaiter {
+public:
+    template <typename U>
+    SendAwaiter(InnerChannel<T, Strategy, Wait, Allocator, Stats, Layout>* channel, U&& value, E& exec) noexcept(std::is_nothrow_constructible_v<T, U&&>)
+        : channel_(channel), exec_(&exec), value_(std::forward<U>(value)) {}
+
+    bool await_ready() noexcept(std::is_nothrow_move_constructible_v<T>) {
+        status_ = channel_->try_send(std::move(value_));
+        return status_ != ResponseStatus::CHANNEL_FULL;
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle) noexcept {
+        waker_ = __waker::make(handle, *exec_);
+        return channel_->park_sender(&waker_);
+    }
+
+    ResponseStatus await_resume() noexcept(std::is_nothrow_move_constructible_v<T>) {
+        while (status_ == ResponseStatus::CHANNEL_FULL) [[ unlikely ]] {
+            status_ = channel_->try_send(std::move(value_));
+        }
+        return status_;
+    }
+
+private:
+    InnerChannel<T, Strategy, Wait, Allocator, Stats, Layout>* channel_;
+    E* exec_;
+    T value_;
+    __waker waker_{};
+    ResponseStatus status_{ ResponseStatus::CHANNEL_FULL };
+};
+
+/// @brief Awaitable returned by Receiver::async_receive
+/// @tparam Out T& to receive into a value owned by the caller, T to keep the value inside the awaiter
+template <typename T, OverflowStrategy Strategy, WaitStrategy Wait, typename Allocator, typename Stats, SlotLayout Layout, executor E, typename Out>
+class ReceiveAwaiter {
+    static constexpr bool by_value = !std::is_reference_v<Out>;
+public:
+    ReceiveAwaiter(InnerChannel<T, Strategy, Wait, Allocator, Stats, Layout>* channel, E& exec) noexcept(std::is_nothrow_default_constructible_v<T>) requires (by_value)
+        : channel_(channel), exec_(&exec), value_() {}
+    ReceiveAwaiter(InnerChannel<T, Strategy, Wait, Allocator, Stats, Layout>* channel, T& value, E& exec) noexcept requires (!by_value)
+        : channel_(channel), exec_(&exec), value_(value) {}
+
+    bool await_ready() noexcept(std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>) {
+        status_ = channel_->try_receive(value_);
+        return status_ != ResponseStatus::CHANNEL_EMPTY;
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle) noexcept {
+        waker_ = __waker::make(handle, *exec_);
+        return channel_->park_receiver(&waker_);
+    }
+
+    /// @return SUCCESS or SENDER_CLOSED for T&, the received value (default constructed once closed) for T
+    auto await_resume() noexcept(std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>) {
+        while (status_ == ResponseStatus::CHANNEL_EMPTY) [[ unlikely ]] {
+            status_ = channel_->try_receive(value_);
+        }
+        if constexpr (by_value) {
+            return std::move(value_);
+        } else {
+            return status_;
+        }
+    }
+
+private:
+    InnerChannel<T, Strategy, Wait, Allocator, Stats, Layout>* channel_;
+    E* exec_;
+    Out value_;
+    __waker waker_{};
+    ResponseStatus status_{ ResponseStatus::CHANNEL_EMPTY };
+};
+
 /// @brief Sender for a single-producer, single-consumer channel
 /// @tparam T The type of values sent through the channel
 /// @tparam Strategy The overflow strategy used by the channel
 /// It allows to send values to the channel. It is designed to be used only from one thread at a time.
-template <typename T, OverflowStrategy Strategy = OverflowStrategy::WAIT_ON_FULL, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
+template <typename T, OverflowStrategy Strategy = OverflowStrategy::WAIT_ON_FULL, WaitStrategy Wait = WaitStrategy::BUSY_LOOP, typename Allocator = std::allocator<T>, typename Stats = no_stats, SlotLayout Layout = SlotLayout::PACKED>
 class Sender {
     /// Disallows sender creation outside of channel function
-    explicit Sender(std::shared_ptr<InnerChannel<T, Strategy, Wait>> chan) : channel_(chan) {}
+    explicit Sender(std::shared_ptr<InnerChannel<T, Strategy, Wait, Allocator, Stats, Layout>> chan) : channel_(chan) {}
 public:
     /// @brief Default constructor
     /// @note required to have sender as class member
@@ -78,11 +231,40 @@ public:
     Sender& operator=(const Sender&) = delete;
 
     Sender& operator=(Sender&& other) noexcept {
-        channel_ = std::move(other.channel_);
+        if (this != &other) {
+            close();
+            channel_ = std::move(other.channel_);
+        }
         return *this;
     } 
     Sender(Sender&& other) noexcept : channel_(std::move(other.channel_)) {}
 
+    /// @brief Destructor, closes the sender
+    ~Sender() {
+        close();
+    }
+
+    /// @brief Close the sender and wake up the receiver
+    /// @note The receiver still gets the values sent before, then SENDER_CLOSED. The sender is empty afterwards.
+    void close() noexcept {
+        if (channel_) {
+            channel_->close_sender();
+            channel_.reset();
+        }
+    }
+
+    /// @brief Check if the receiver was closed, values sent from now on are never received
+    /// @note Sending reports it as CHANNEL_CLOSED only when it gets to the slow path (the cached free space is used up)
+    bool is_closed() const noexcept {
+        return !channel_ || channel_->receiver_closed();
+    }
+
+    /// @brief Snapshot of the channel counters kept by the Stats policy
+    /// @note May be called from any thread, e.g. a metrics thread, while the channel is in use
+    channel_stats stats() const noexcept requires (Stats::enabled) {
+        return channel_->stats();
+    }
+
     /// @brief Try to send a value to the channel
     /// @param value The value to send
     /// @return ResponseStatus indicating the result of the operation
@@ -93,54 +275,181 @@ public:
 
     /// @brief Send a value to the channel (copy version)
     /// @param value The value to send
+    /// @return SUCCESS, or CHANNEL_CLOSED if the receiver was closed
     /// @note This function is blocking and will wait until the value is sent.
-    void send(const T& value) noexcept(std::is_nothrow_constructible_v<T, const T&>) {
-        if (channel_->try_send(value) != ResponseStatus::SUCCESS) [[ unlikely ]] {
-            do {
-                if constexpr (Wait == WaitStrategy::YIELD) {
-                    std::this_thread::yield(); // Yield to allow other threads to run
-                } else if constexpr (Wait == WaitStrategy::BUSY_LOOP) {
-                    asm volatile ("" ::: "memory"); // Busy loop, just spin with compiler barrier
-                } else if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
-                    channel_->rcvCursor_.wait(channel_->rcvCursorCache_, std::memory_order_acquire);
-                }
-
-            } while (channel_->try_send(value) != ResponseStatus::SUCCESS); 
+    ResponseStatus send(const T& value) noexcept(std::is_nothrow_constructible_v<T, const T&>) {
+        ResponseStatus status = channel_->try_send(value);
+        if (status != ResponseStatus::SUCCESS) [[ unlikely ]] {
+            channel_->trace(TraceEvent::SEND_BLOCKED, status);
+            while (status != ResponseStatus::SUCCESS && status != ResponseStatus::CHANNEL_CLOSED) {
+                wait_for_space();
+                status = channel_->try_send(value);
+            }
+            channel_->trace(TraceEvent::SEND_RESUMED, status);
         }
+        return status;
     }
 
     /// @brief Send a value to the channel (move version)
     /// @param value The value to send
+    /// @return SUCCESS, or CHANNEL_CLOSED if the receiver was closed
     /// @note This function is lock-free but may block if the channel is full.
-    void send(T&& value) noexcept(std::is_nothrow_constructible_v<T, T&&>) {
-        if (channel_->try_send(std::move(value)) != ResponseStatus::SUCCESS) [[ unlikely ]] {
-            do {
-                if constexpr (Wait == WaitStrategy::YIELD) {
-                    std::this_thread::yield(); // Yield to allow other threads to run
-                } else if constexpr (Wait == WaitStrategy::BUSY_LOOP) {
-                    asm volatile ("" ::: "memory"); // Busy loop, just spin with compiler barrier
-                } else if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
-                    channel_->rcvCursor_.wait(channel_->rcvCursorCache_, std::memory_order_acquire);
-                }
+    ResponseStatus send(T&& value) noexcept(std::is_nothrow_constructible_v<T, T&&>) {
+        ResponseStatus status = channel_->try_send(std::move(value));
+        if (status != ResponseStatus::SUCCESS) [[ unlikely ]] {
+            channel_->trace(TraceEvent::SEND_BLOCKED, status);
+            while (status != ResponseStatus::SUCCESS && status != ResponseStatus::CHANNEL_CLOSED) {
+                wait_for_space();
+                status = channel_->try_send(std::move(value));
+            }
+            channel_->trace(TraceEvent::SEND_RESUMED, status);
+        }
+        return status;
+    }
+
+    /// @brief Send a value to the channel, waiting for free space at most until deadline (copy version)
+    /// @param value The value to send
+    /// @param deadline Point in time after which the sender gives up
+    /// @return SUCCESS, CHANNEL_CLOSED, or the status of the last attempt (CHANNEL_FULL) if the deadline has passed
+    /// @note The clock is read only while waiting, so the fast path costs the same as try_send
+    template <typename Clock, typename Duration>
+    ResponseStatus send_until(const T& value, const std::chrono::time_point<Clock, Duration>& deadline) noexcept(std::is_nothrow_constructible_v<T, const T&>) {
+        ResponseStatus status;
+        while ((status = channel_->try_send(value)) != ResponseStatus::SUCCESS) {
+            if (status == ResponseStatus::CHANNEL_CLOSED || !wait_for_space_until(deadline)) {
+                return status;
+            }
+        }
+        return status;
+    }
+
+    /// @brief Send a value to the channel, waiting for free space at most until deadline (move version)
+    /// @param value The value to send, it is moved from only if SUCCESS is returned
+    /// @param deadline Point in time after which the sender gives up
+    /// @return SUCCESS, CHANNEL_CLOSED, or the status of the last attempt (CHANNEL_FULL) if the deadline has passed
+    template <typename Clock, typename Duration>
+    ResponseStatus send_until(T&& value, const std::chrono::time_point<Clock, Duration>& deadline) noexcept(std::is_nothrow_constructible_v<T, T&&>) {
+        ResponseStatus status;
+        while ((status = channel_->try_send(std::move(value))) != ResponseStatus::SUCCESS) {
+            if (status == ResponseStatus::CHANNEL_CLOSED || !wait_for_space_until(deadline)) {
+                return status;
+            }
+        }
+        return status;
+    }
+
+    /// @brief Send a value to the channel, waiting for free space at most for timeout
+    /// @return SUCCESS, CHANNEL_CLOSED, or the status of the last attempt (CHANNEL_FULL) if the time has run out
+    template <typename U, typename Rep, typename Period>
+    ResponseStatus send_for(U&& value, const std::chrono::duration<Rep, Period>& timeout) noexcept(noexcept(send_until(std::forward<U>(value), std::chrono::steady_clock::now()))) {
+        return send_until(std::forward<U>(value), std::chrono::steady_clock::now() + timeout);
+    }
 
-            } while (channel_->try_send(std::move(value)) != ResponseStatus::SUCCESS); 
+    /// @brief Send a value from a coroutine, suspending it while the channel is full
+    /// @param value The value to send, it is moved (or copied) into the awaitable
+    /// @param exec Executor the coroutine is resumed on once the receiver frees a slot
+    /// @return Awaitable yielding SUCCESS, or CHANNEL_CLOSED if the receiver was closed
+    /// @note The default inline_executor resumes the coroutine on the receiver thread, inside its receive call
+    template <typename U, executor E = inline_executor>
+    SendAwaiter<T, Strategy, Wait, Allocator, Stats, Layout, E> async_send(U&& value, E& exec = inline_executor::instance()) noexcept(std::is_nothrow_constructible_v<T, U&&>)
+        requires (Wait == WaitStrategy::ASYNC && Strategy == OverflowStrategy::WAIT_ON_FULL) {
+        return { channel_.get(), std::forward<U>(value), exec };
+    }
+
+    /// @brief Try to send a run of values to the channel
+    /// @param first Iterator to the first value to send
+    /// @param last Iterator past the last value to send
+    /// @return Number of values sent, it is lower than the length of the run if the channel does not have enough space
+    /// @note Values are copied, use std::make_move_iterator to move them instead
+    /// @note This function is lock-free and wait-free. The whole run is published with a single cursor store.
+    template<std::forward_iterator It>
+    size_t try_send_n(It first, It last) noexcept(std::is_nothrow_constructible_v<T, std::iter_reference_t<It>>) {
+        return channel_->try_send_n(first, last);
+    }
+
+    /// @brief Send a run of values to the channel
+    /// @param first Iterator to the first value to send
+    /// @param last Iterator past the last value to send
+    /// @return Number of values sent, lower than the length of the run only if the receiver was closed
+    /// @note This function is blocking and will wait until all values are sent.
+    template<std::forward_iterator It>
+    size_t send_n(It first, It last) noexcept(std::is_nothrow_constructible_v<T, std::iter_reference_t<It>>) {
+        size_t sent = channel_->try_send_n(first, last);
+        if (first != last) [[ unlikely ]] {
+            channel_->trace(TraceEvent::SEND_BLOCKED, ResponseStatus::CHANNEL_FULL);
+            while (first != last && !channel_->receiver_closed()) {
+                wait_for_space();
+                sent += channel_->try_send_n(first, last);
+            }
+            channel_->trace(TraceEvent::SEND_RESUMED, first == last ? ResponseStatus::SUCCESS : ResponseStatus::CHANNEL_CLOSED);
         }
+        return sent;
+    }
+
+    /// @brief Reserve up to n free slots for writing in place
+    /// @param n Maximum number of slots to reserve
+    /// @return Reserved slots, empty if the channel is full
+    /// @note Slots are not visible to the receiver until they are committed
+    /// @note Only available for trivially copyable T, slots are raw memory and are written without constructors
+    /// @note Not available with SlotLayout::PADDED, padded slots are not contiguous
+    RingSpan<T> reserve(size_t n) noexcept
+        requires (Strategy == OverflowStrategy::WAIT_ON_FULL && std::is_trivially_copyable_v<T> && Layout != SlotLayout::PADDED) {
+        return channel_->reserve(n);
+    }
+
+    /// @brief Publish first n slots of the last reservation to the receiver
+    /// @param n Number of slots to publish, must not exceed size of the last reservation
+    void commit(size_t n) noexcept
+        requires (Strategy == OverflowStrategy::WAIT_ON_FULL && std::is_trivially_copyable_v<T> && Layout != SlotLayout::PADDED) {
+        channel_->commit(n);
     }
 
 private:
-    std::shared_ptr<InnerChannel<T, Strategy, Wait>> channel_;
+    std::shared_ptr<InnerChannel<T, Strategy, Wait, Allocator, Stats, Layout>> channel_;
+
+    /// @brief Wait for the receiver to free some space according to the wait strategy
+    inline void wait_for_space() noexcept {
+        channel_->stats_.send_waited();
+        if constexpr (Wait == WaitStrategy::YIELD || Wait == WaitStrategy::ASYNC) {
+            std::this_thread::yield(); // Yield to allow other threads to run
+        } else if constexpr (Wait == WaitStrategy::BUSY_LOOP) {
+            asm volatile ("" ::: "memory"); // Busy loop, just spin with compiler barrier
+        } else if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
+            channel_->rcvCursor_.wait(channel_->rcvCursorCache_, std::memory_order_acquire);
+        } else if constexpr (Wait == WaitStrategy::ADAPTIVE) {
+            uint64_t parks = 0;
+            channel_->parkers_.space.wait(channel_->rcvCursor_, channel_->rcvCursorCache_, Stats::enabled ? &parks : nullptr);
+            channel_->stats_.sender_parked(parks);
+        }
+    }
 
-    friend std::pair<Sender<T, Strategy, Wait>, Receiver<T, Strategy, Wait>> channel<T, Strategy, Wait>(size_t capacity);
+    /// @brief Wait for the receiver to free some space according to the wait strategy, at most until deadline
+    /// @return false if the deadline has passed
+    template <typename Clock, typename Duration>
+    inline bool wait_for_space_until(const std::chrono::time_point<Clock, Duration>& deadline) noexcept {
+        channel_->stats_.send_waited();
+        if constexpr (Wait == WaitStrategy::ADAPTIVE) {
+            uint64_t parks = 0;
+            const bool in_time = channel_->parkers_.space.wait_until(channel_->rcvCursor_, channel_->rcvCursorCache_, deadline, Stats::enabled ? &parks : nullptr);
+            channel_->stats_.sender_parked(parks);
+            return in_time;
+        } else {
+            return __wait_until<Wait>(channel_->rcvCursor_, channel_->rcvCursorCache_, deadline);
+        }
+    }
+
+    friend std::pair<Sender<T, Strategy, Wait, Allocator, Stats, Layout>, Receiver<T, Strategy, Wait, Allocator, Stats, Layout>> channel<T, Strategy, Wait, Allocator, Stats, Layout>(size_t capacity, const Allocator& alloc);
+    template<typename, size_t, OverflowStrategy, WaitStrategy, typename, SlotLayout> friend class static_channel;
 };
 
 /// @brief Receiver for a single-producer, single-consumer channel
 /// @tparam T The type of values sent through the channel
 /// @tparam Strategy The overflow strategy used by the channel
 /// It allows to receive values from the channel. It is designed to be used only from one thread at a time.
-template <typename T, OverflowStrategy Strategy = OverflowStrategy::WAIT_ON_FULL, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
+template <typename T, OverflowStrategy Strategy = OverflowStrategy::WAIT_ON_FULL, WaitStrategy Wait = WaitStrategy::BUSY_LOOP, typename Allocator = std::allocator<T>, typename Stats = no_stats, SlotLayout Layout = SlotLayout::PACKED>
 class Receiver {
     /// Disallows receiver creation outside of channel function
-    explicit Receiver(std::shared_ptr<InnerChannel<T, Strategy, Wait>> chan) : channel_(chan) {}
+    explicit Receiver(std::shared_ptr<InnerChannel<T, Strategy, Wait, Allocator, Stats, Layout>> chan) : channel_(chan) {}
 public:
     /// @brief Default constructor
     /// @note required to have receiver as class member
@@ -149,11 +458,39 @@ public:
     Receiver& operator=(const Receiver&) = delete;
 
     Receiver& operator=(Receiver&& other) noexcept {
-        channel_ = std::move(other.channel_);
+        if (this != &other) {
+            close();
+            channel_ = std::move(other.channel_);
+        }
         return *this;
     }
     Receiver(Receiver&& other) noexcept : channel_(std::move(other.channel_)) {}
 
+    /// @brief Destructor, closes the receiver
+    ~Receiver() {
+        close();
+    }
+
+    /// @brief Close the receiver and wake up the sender
+    /// @note Values left in the channel are destroyed with it. The receiver is empty afterwards.
+    void close() noexcept {
+        if (channel_) {
+            channel_->close_receiver();
+            channel_.reset();
+        }
+    }
+
+    /// @brief Check if the sender was closed, values sent before can still be received
+    bool is_closed() const noexcept {
+        return !channel_ || channel_->sender_closed();
+    }
+
+    /// @brief Snapshot of the channel counters kept by the Stats policy
+    /// @note May be called from any thread, e.g. a metrics thread, while the channel is in use
+    channel_stats stats() const noexcept requires (Stats::enabled) {
+        return channel_->stats();
+    }
+
     /// @brief Try to receive a value from the channel
     /// @param value The received value
     /// @return ResponseStatus indicating the result of the operation
@@ -165,45 +502,302 @@ public:
     /// @brief Receive a value from the channel
     /// @return The received value
     /// @note This function is lock-free but may block if the channel is empty.
+    /// @note If the sender was closed and the channel is drained a default constructed value is returned,
+    /// use receive(T&) to tell it apart from a received one.
     T receive() noexcept(std::is_nothrow_default_constructible_v<T> && std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>) {
-        T value;
-        if (channel_->try_receive(value) != ResponseStatus::SUCCESS) [[ unlikely ]] {
-            do {
-                if constexpr (Wait == WaitStrategy::YIELD) {
-                    std::this_thread::yield(); // Yield to allow other threads to run
-                } else if constexpr (Wait == WaitStrategy::BUSY_LOOP) {
-                    asm volatile ("" ::: "memory"); // Busy loop, just spin with compiler barrier
-                } else if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
-                    channel_->sendCursor_.wait(channel_->sendCursorCache_, std::memory_order_acquire);
+        T value{};
+        receive(value);
+        return value;
+    }
+
+    /// @brief Receive a value from the channel
+    /// @param value The received value
+    /// @return SUCCESS, or SENDER_CLOSED if the sender was closed and the channel is drained
+    /// @note This function is lock-free but may block if the channel is empty.
+    ResponseStatus receive(T& value) noexcept(std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>) {
+        ResponseStatus status = channel_->try_receive(value);
+        if (status != ResponseStatus::SUCCESS) [[ unlikely ]] {
+            channel_->trace(TraceEvent::RECEIVE_BLOCKED, status);
+            while (status != ResponseStatus::SUCCESS && status != ResponseStatus::SENDER_CLOSED) {
+                wait_for_data();
+                status = channel_->try_receive(value);
+            }
+            channel_->trace(TraceEvent::RECEIVE_RESUMED, status);
+        }
+        return status;
+    }
+
+    /// @brief Receive a value from the channel, waiting for it at most until deadline
+    /// @param value The received value
+    /// @param deadline Point in time after which the receiver gives up
+    /// @return SUCCESS, SENDER_CLOSED, or the status of the last attempt (CHANNEL_EMPTY) if the deadline has passed
+    /// @note The clock is read only while waiting, so the fast path costs the same as try_receive
+    template <typename Clock, typename Duration>
+    ResponseStatus receive_until(T& value, const std::chrono::time_point<Clock, Duration>& deadline) noexcept(std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>) {
+        ResponseStatus status;
+        while ((status = channel_->try_receive(value)) != ResponseStatus::SUCCESS) {
+            if (status == ResponseStatus::SENDER_CLOSED || !wait_for_data_until(deadline)) {
+                return status;
+            }
+        }
+        return status;
+    }
+
+    /// @brief Receive a value from the channel, waiting for it at most for timeout
+    /// @return SUCCESS, SENDER_CLOSED, or the status of the last attempt (CHANNEL_EMPTY) if the time has run out
+    template <typename Rep, typename Period>
+    ResponseStatus receive_for(T& value, const std::chrono::duration<Rep, Period>& timeout) noexcept(std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>) {
+        return receive_until(value, std::chrono::steady_clock::now() + timeout);
+    }
+
+    /// @brief Receive a value from a coroutine, suspending it while the channel is empty
+    /// @param value The received value
+    /// @param exec Executor the coroutine is resumed on once the sender publishes a value
+    /// @return Awaitable yielding SUCCESS, or SENDER_CLOSED if the sender was closed and the channel is drained
+    /// @note The default inline_executor resumes the coroutine on the sender thread, inside its send call
+    template <executor E = inline_executor>
+    ReceiveAwaiter<T, Strategy, Wait, Allocator, Stats, Layout, E, T&> async_receive(T& value, E& exec = inline_executor::instance()) noexcept
+        requires (Wait == WaitStrategy::ASYNC && Strategy == OverflowStrategy::WAIT_ON_FULL) {
+        return { channel_.get(), value, exec };
+    }
+
+    /// @brief Receive a value from a coroutine, suspending it while the channel is empty
+    /// @param exec Executor the coroutine is resumed on once the sender publishes a value
+    /// @return Awaitable yielding the received value, default constructed if the sender was closed and the channel is drained
+    template <executor E = inline_executor>
+    ReceiveAwaiter<T, Strategy, Wait, Allocator, Stats, Layout, E, T> async_receive(E& exec = inline_executor::instance()) noexcept(std::is_nothrow_default_constructible_v<T>)
+        requires (Wait == WaitStrategy::ASYNC && Strategy == OverflowStrategy::WAIT_ON_FULL) {
+        return { channel_.get(), exec };
+    }
+
+    /// @brief Try to receive up to max values from the channel
+    /// @param out Output iterator the received values are moved into
+    /// @param max Maximum number of values to receive
+    /// @return Number of values received, 0 if the channel is empty
+    /// @note This function is lock-free and wait-free. The whole run is released with a single cursor store.
+    template<std::output_iterator<T> It>
+    size_t try_receive_n(It out, size_t max) noexcept(noexcept(*out = std::declval<T&&>()) && std::is_nothrow_destructible_v<T>) {
+        return channel_->try_receive_n(out, max);
+    }
+
+    /// @brief Receive exactly n values from the channel
+    /// @param out Output iterator the received values are moved into
+    /// @param n Number of values to receive
+    /// @return Number of values received, lower than n only if the sender was closed and the channel is drained
+    /// @note This function is blocking and will wait until all n values are received.
+    template<std::output_iterator<T> It>
+    size_t receive_n(It out, size_t n) noexcept(noexcept(*out = std::declval<T&&>()) && std::is_nothrow_destructible_v<T>) {
+        size_t received = channel_->try_receive_n(out, n);
+        if (received != n) [[ unlikely ]] {
+            channel_->trace(TraceEvent::RECEIVE_BLOCKED, ResponseStatus::CHANNEL_EMPTY);
+            while (received != n) {
+                const bool closed = channel_->sender_closed();
+                const size_t count = channel_->try_receive_n(out, n - received);
+                if (count == 0) {
+                    if (closed) {
+                        break;
+                    }
+                    wait_for_data();
                 }
-            } while (channel_->try_receive(value) != ResponseStatus::SUCCESS); 
+                received += count;
+            }
+            channel_->trace(TraceEvent::RECEIVE_RESUMED, received == n ? ResponseStatus::SUCCESS : ResponseStatus::SENDER_CLOSED);
         }
-        return value;
+        return received;
+    }
+
+    /// @brief Peek at the values that are ready to be received without moving them out of the channel
+    /// @return Ready slots, empty if the channel is empty
+    /// @note Values stay in the channel until they are released
+    /// @note Not available with SlotLayout::PADDED, padded slots are not contiguous
+    RingSpan<T> peek() noexcept requires (Strategy == OverflowStrategy::WAIT_ON_FULL && Layout != SlotLayout::PADDED) {
+        return channel_->peek();
+    }
+
+    /// @brief Destroy first n peeked values and give their slots back to the sender
+    /// @param n Number of values to release, must not exceed size of the last peek
+    void release(size_t n) noexcept(std::is_nothrow_destructible_v<T>) requires (Strategy == OverflowStrategy::WAIT_ON_FULL && Layout != SlotLayout::PADDED) {
+        channel_->release(n);
     }
 
 private:
-    std::shared_ptr<InnerChannel<T, Strategy, Wait>> channel_;
+    std::shared_ptr<InnerChannel<T, Strategy, Wait, Allocator, Stats, Layout>> channel_;
+
+    /// @brief Wait for the sender to publish some values according to the wait strategy
+    inline void wait_for_data() noexcept {
+        channel_->stats_.receive_waited();
+        if constexpr (Wait == WaitStrategy::YIELD || Wait == WaitStrategy::ASYNC) {
+            std::this_thread::yield(); // Yield to allow other threads to run
+        } else if constexpr (Wait == WaitStrategy::BUSY_LOOP) {
+            asm volatile ("" ::: "memory"); // Busy loop, just spin with compiler barrier
+        } else if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
+            channel_->sendCursor_.wait(channel_->sendCursorCache_, std::memory_order_acquire);
+        } else if constexpr (Wait == WaitStrategy::ADAPTIVE) {
+            uint64_t parks = 0;
+            channel_->parkers_.data.wait(channel_->sendCursor_, channel_->sendCursorCache_, Stats::enabled ? &parks : nullptr);
+            channel_->stats_.receiver_parked(parks);
+        }
+    }
+
+    /// @brief Wait for the sender to publish some values according to the wait strategy, at most until deadline
+    /// @return false if the deadline has passed
+    template <typename Clock, typename Duration>
+    inline bool wait_for_data_until(const std::chrono::time_point<Clock, Duration>& deadline) noexcept {
+        channel_->stats_.receive_waited();
+        if constexpr (Wait == WaitStrategy::ADAPTIVE) {
+            uint64_t parks = 0;
+            const bool in_time = channel_->parkers_.data.wait_until(channel_->sendCursor_, channel_->sendCursorCache_, deadline, Stats::enabled ? &parks : nullptr);
+            channel_->stats_.receiver_parked(parks);
+            return in_time;
+        } else {
+            return __wait_until<Wait>(channel_->sendCursor_, channel_->sendCursorCache_, deadline);
+        }
+    }
 
-    friend std::pair<Sender<T, Strategy, Wait>, Receiver<T, Strategy, Wait>> channel<T, Strategy, Wait>(size_t capacity);
+    friend std::pair<Sender<T, Strategy, Wait, Allocator, Stats, Layout>, Receiver<T, Strategy, Wait, Allocator, Stats, Layout>> channel<T, Strategy, Wait, Allocator, Stats, Layout>(size_t capacity, const Allocator& alloc);
+    template<typename, size_t, OverflowStrategy, WaitStrategy, typename, SlotLayout> friend class static_channel;
+    friend class channels::selector;
+};
+
+/// @brief Raw storage of one value padded to a whole cache line, used by SlotLayout::PADDED
+template <typename T>
+struct alignas(cache_line_size) __padded_slot {
+    alignas(T) unsigned char bytes[sizeof(T)];
+};
+
+/// @brief Slot type of the ring, sequenced channels keep a stamp next to every value
+template <typename T, OverflowStrategy Strategy, SlotLayout Layout>
+using __slot_t = std::conditional_t<Strategy == OverflowStrategy::OVERWRITE_SEQUENCED, __sequenced_slot<T>,
+                 std::conditional_t<Layout == SlotLayout::PADDED, __padded_slot<T>, T>>;
+
+/// @brief Alignment of the ring, LINE_RELEASE starts it on a line so groups of slots match cache lines
+template <typename Slot, SlotLayout Layout>
+inline constexpr size_t __ring_alignment = Layout == SlotLayout::LINE_RELEASE ? std::max(alignof(Slot), cache_line_size) : alignof(Slot);
+
+/// @brief Ring buffer of InnerChannel allocated with the channel allocator, the capacity is chosen at runtime
+/// @note This class is NOT intended to be used directly by the user
+template <typename Slot, typename Allocator, size_t Align = alignof(Slot)>
+class __ring_storage {
+    /// Over-aligned rings are allocated as blocks of Align bytes, allocators are not required to support aligned allocation
+    struct alignas(Align) block_type {
+        unsigned char bytes[Align];
+    };
+    static constexpr bool over_aligned = Align > alignof(Slot);
+    using unit_type = std::conditional_t<over_aligned, block_type, Slot>;
+    using allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<unit_type>;
+    using allocator_traits = std::allocator_traits<allocator_type>;
+protected:
+    /// @param capacity The minimum capacity, for performance it will be allocated with next power of 2
+    /// Uses raw memory allocation so the T type is not required to provide default constructors
+    /// alignment is the key for performance it makes sure that objects are properly aligned in memory for faster access
+    __ring_storage(size_t capacity, const Allocator& alloc) :
+        capacity_(next_power_of_2(capacity)),
+        capacity_mask_(capacity_ - 1),
+        allocator_(alloc),
+        buffer_(allocate_buffer()) {}
+
+    ~__ring_storage() {
+        unit_type* units = reinterpret_cast<unit_type*>(buffer_);
+        allocator_traits::deallocate(allocator_, std::pointer_traits<typename allocator_traits::pointer>::pointer_to(*units), units_count());
+    }
+
+    const size_t capacity_;
+    const size_t capacity_mask_; // mask for bitwise next_index
+    [[no_unique_address]] allocator_type allocator_;
+    Slot* buffer_;
+
+private:
+    /// @brief Allocate raw memory for the ring buffer with the channel allocator
+    /// @return Pointer to the uninitialized buffer
+    inline Slot* allocate_buffer() {
+        __allocation_guard<allocator_type> guard(allocator_, units_count());
+        return reinterpret_cast<Slot*>(std::to_address(guard.release()));
+    }
+
+    /// @brief Number of allocated units holding capacity_ slots
+    inline size_t units_count() const noexcept {
+        if constexpr (over_aligned) {
+            return (capacity_ * sizeof(Slot) + Align - 1) / Align;
+        } else {
+            return capacity_;
+        }
+    }
+
+    /// @brief Calculate the next power of 2 greater than or equal to n
+    /// @param n The input value
+    /// @return The next power of 2
+    static constexpr size_t next_power_of_2(const size_t n) noexcept {
+        if (n <= 1) return 1;
+        
+        // Use bit manipulation for efficiency
+        size_t power = 1;
+        while (power < n) {
+            power <<= 1;
+        }
+        return power;
+    }
+};
+
+/// @brief Ring buffer of N slots stored inline in InnerChannel
+/// The capacity and the mask are constants, so indexing needs neither a load of the mask nor of the buffer pointer.
+/// @note This class is NOT intended to be used directly by the user
+template <typename Slot, size_t N, size_t Align>
+class __ring_storage<Slot, static_storage<N>, Align> {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "static_storage capacity has to be a power of two, at least 2");
+protected:
+    /// @brief The capacity is given by N, the runtime one is ignored
+    __ring_storage(size_t, const static_storage<N>&) noexcept {}
+
+    /// Slots are constructed and destroyed by InnerChannel
+    ~__ring_storage() {}
+
+    static constexpr size_t capacity_ = N;
+    static constexpr size_t capacity_mask_ = N - 1; // mask for bitwise next_index
+
+    /// Union keeps the slots uninitialized, so the T type is not required to provide default constructors
+    union {
+        alignas(Align) Slot buffer_[N];
+    };
 };
 
 /// @brief Inner channel implementation for the SPSC queue
 /// @tparam T The type of values sent through the channel
 /// @tparam Strategy The overflow strategy to use when the channel is full
 /// @tparam Wait The wait strategy used for internal operations
+/// @tparam Allocator The allocator used for the ring buffer, or static_storage<N> to keep the ring inline
+/// @tparam Stats Statistics policy, its hooks are called on every operation
+/// @tparam Layout Placement of the slots relative to cache lines, see SlotLayout
 /// This class is not intended to be used directly by users.
 /// @note this class is not thread safe and should be wrapped in std::shared_ptr
-template <typename T, OverflowStrategy Strategy = OverflowStrategy::WAIT_ON_FULL, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
-class InnerChannel {
+template <typename T, OverflowStrategy Strategy = OverflowStrategy::WAIT_ON_FULL, WaitStrategy Wait = WaitStrategy::BUSY_LOOP, typename Allocator = std::allocator<T>, typename Stats = no_stats, SlotLayout Layout = SlotLayout::PACKED>
+class InnerChannel : private __ring_storage<__slot_t<T, Strategy, Layout>, Allocator, __ring_alignment<__slot_t<T, Strategy, Layout>, Layout>> {
+    /// Sequenced channels keep a stamp next to every value, cursors count messages and only their low bits index the ring
+    static constexpr bool sequenced = Strategy == OverflowStrategy::OVERWRITE_SEQUENCED;
+    static constexpr bool padded = Layout == SlotLayout::PADDED;
+    static constexpr bool line_release = Layout == SlotLayout::LINE_RELEASE;
+    /// LINE_RELEASE publishes the receiver cursor once it leaves a group of slots_per_line slots
+    static constexpr size_t slots_per_line = __slots_per_line<T>;
+    using slot_type = __slot_t<T, Strategy, Layout>;
+    using storage_type = __ring_storage<slot_type, Allocator, __ring_alignment<slot_type, Layout>>;
+    /// Runs of trivially copyable values between the ring and contiguous memory are copied as bytes, one memcpy per segment
+    static constexpr bool bulk_copyable = std::is_trivially_copyable_v<T> && !padded;
+    template <typename It>
+    static constexpr bool contiguous_run = std::contiguous_iterator<It> && std::is_same_v<std::remove_cv_t<std::iter_value_t<It>>, T>;
+    using storage_type::capacity_;
+    using storage_type::capacity_mask_;
+    using storage_type::buffer_;
+
+    static_assert(!sequenced || std::is_trivially_copyable_v<T>, "OVERWRITE_SEQUENCED copies values with memcpy, T has to be trivially copyable");
+    static_assert(!sequenced || Layout == SlotLayout::PACKED, "OVERWRITE_SEQUENCED supports only SlotLayout::PACKED");
+    static_assert(!line_release || Strategy == OverflowStrategy::WAIT_ON_FULL, "SlotLayout::LINE_RELEASE supports only OverflowStrategy::WAIT_ON_FULL");
 public:
     /// @brief Construct a channel with a given capacity
     /// @param capacity The minimum capacity of the channel, for performance it will be allocated with next power of 2
-    /// Uses raw memory allocation so the T type is not required to provide default constructors
-    /// alignment is the key for performance it makes sure that objects are properly aligned in memory for faster access
-    explicit InnerChannel(size_t capacity) : 
-        capacity_(next_power_of_2(capacity)),
-        capacity_mask_(capacity_ - 1),
-        buffer_(static_cast<T*>(operator new[](capacity_ * sizeof(T), std::align_val_t{alignof(T)}))) {
+    /// @param alloc The allocator used for the ring buffer
+    /// @note With static_storage<N> the capacity is N and the capacity argument is ignored
+    /// @note With LINE_RELEASE the capacity is at least two lines of slots, so the sender always has a released line to fill
+    explicit InnerChannel(size_t capacity, const Allocator& alloc = Allocator()) : 
+        storage_type(line_release ? std::max(capacity, 2 * slots_per_line) : capacity, alloc) {
         
         // Initialize cache values for better performance
         rcvCursorCache_ = 0;
@@ -213,26 +807,26 @@ public:
         if constexpr (Strategy == OverflowStrategy::OVERWRITE_ON_FULL) {
             oldestOccupied_.store(false, std::memory_order_relaxed);
         }
+
+        // Stamps start at 0, which no message ever uses
+        if constexpr (sequenced) {
+            std::uninitialized_value_construct_n(buffer_, capacity_);
+        }
     }
     
     /// This should not be called if there is existing handle to reader or writer
     ~InnerChannel() {
-        size_t sendCursor = sendCursor_.load(std::memory_order_seq_cst);
-        size_t rcvCursor = rcvCursor_.load(std::memory_order_seq_cst);
+        size_t sendCursor = sendCursor_.load(std::memory_order_seq_cst) & ~closed_bit;
+        size_t rcvCursor = line_release ? rcvPosition_ : rcvCursor_.load(std::memory_order_seq_cst) & ~closed_bit;
 
-        // Call destructors for all elements in the buffer
-        size_t i = rcvCursor;
-        while (i != sendCursor) {
-            buffer_[i].~T();
-            i = next_index(i);
+        // Call destructors for all elements in the buffer, sequenced slots hold trivially copyable values only
+        if constexpr (!sequenced && !std::is_trivially_destructible_v<T>) {
+            size_t i = rcvCursor;
+            while (i != sendCursor) {
+                slot(i)->~T();
+                i = next_index(i);
+            }
         }
-
-        // Deallocate the buffer
-        ::operator delete[](
-            buffer_,
-            capacity_ * sizeof(T),
-            std::align_val_t{alignof(T)}
-        );
     }
 
     /// @brief Try to send a value to the channel
@@ -243,6 +837,8 @@ public:
     ResponseStatus try_send(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&>) {
         if constexpr (Strategy == OverflowStrategy::WAIT_ON_FULL) {
             return try_send_wait_on_full(std::forward<U>(value));
+        } else if constexpr (sequenced) {
+            return try_send_sequenced(std::forward<U>(value));
         } else {
             return try_send_overwrite_on_full(std::forward<U>(value));
         }
@@ -253,46 +849,435 @@ public:
     /// @return True if the value was received successfully, false if the channel is empty
     /// @note This function is lock-free and wait-free
     ResponseStatus try_receive(T& value) noexcept(std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>) {
-        if constexpr (Strategy == OverflowStrategy::OVERWRITE_ON_FULL) {
-            // Set reader active flag to prevent overwrites during read
-            bool isOccupied = oldestOccupied_.exchange(true, std::memory_order_acq_rel);
-            if (isOccupied) {
-                // It means that the oldest element is being overwritten so we cannot read
-                return ResponseStatus::SKIP_DUE_TO_OVERWRITE;
+        if constexpr (sequenced) {
+            return try_receive_sequenced(&value);
+        } else {
+            if constexpr (Strategy == OverflowStrategy::OVERWRITE_ON_FULL) {
+                // Set reader active flag to prevent overwrites during read
+                bool isOccupied = oldestOccupied_.exchange(true, std::memory_order_acq_rel);
+                if (isOccupied) {
+                    // It means that the oldest element is being overwritten so we cannot read
+                    stats_.receive_skipped();
+                    return ResponseStatus::SKIP_DUE_TO_OVERWRITE;
+                }
             }
-        }
         
-        size_t rcvCursor = rcvCursor_.load(std::memory_order_relaxed); // only receiver thread reads this
+            size_t rcvCursor = receiver_position();
+            drop_stale_cache(rcvCursor);
 
-        if (rcvCursor == sendCursorCache_) {
-            // Refresh cache
-            sendCursorCache_ = sendCursor_.load(std::memory_order_acquire);
             if (rcvCursor == sendCursorCache_) {
+                // Refresh cache
+                const size_t sendCursor = sendCursor_.load(std::memory_order_acquire);
+                sendCursorCache_ = sendCursor & ~closed_bit;
+                if (rcvCursor == sendCursorCache_) {
+                    if constexpr (Strategy == OverflowStrategy::OVERWRITE_ON_FULL) {
+                        oldestOccupied_.store(false, std::memory_order_release);
+                    }
+
+                    // Values sent before closing are still received, the sender is reported only once the ring is drained
+                    if (sendCursor & closed_bit) {
+                        return ResponseStatus::SENDER_CLOSED;
+                    }
+                    stats_.empty();
+                    return ResponseStatus::CHANNEL_EMPTY;
+                }
+            }
+
+            value = std::move(*slot(rcvCursor));
+            slot(rcvCursor)->~T(); // Call destructor
+
+            advance_receiver(rcvCursor, next_index(rcvCursor));
+            stats_.received(1);
+        
+            if constexpr (Strategy == OverflowStrategy::OVERWRITE_ON_FULL) {
+                oldestOccupied_.store(false, std::memory_order_release);
+            }
+
+            return ResponseStatus::SUCCESS;
+        }
+    }
+
+    /// @brief Try to send a run of values to the channel
+    /// @param first Iterator to the first value to send, it is advanced past the last sent value
+    /// @param last Iterator past the last value to send
+    /// @return Number of values sent
+    /// @note This function is lock-free and wait-free
+    template<std::forward_iterator It>
+    size_t try_send_n(It& first, const It last) noexcept(std::is_nothrow_constructible_v<T, std::iter_reference_t<It>>) {
+        if constexpr (Strategy == OverflowStrategy::WAIT_ON_FULL) {
+            return try_send_n_wait_on_full(first, last);
+        } else {
+            // Overwriting has to synchronize with the receiver for every single slot
+            size_t sent = 0;
+            while (first != last && try_send(*first) == ResponseStatus::SUCCESS) {
+                ++first;
+                ++sent;
+            }
+            return sent;
+        }
+    }
+
+    /// @brief Try to receive up to max values from the channel
+    /// @param out Output iterator the received values are moved into, it is advanced past the last written value
+    /// @param max Maximum number of values to receive
+    /// @return Number of values received
+    /// @note This function is lock-free and wait-free
+    template<std::output_iterator<T> It>
+    size_t try_receive_n(It& out, const size_t max) noexcept(noexcept(*out = std::declval<T&&>()) && std::is_nothrow_destructible_v<T>) {
+        if constexpr (sequenced) {
+            // Every slot is validated on its own, the values are copied out one by one
+            size_t count = 0;
+            alignas(T) unsigned char storage[sizeof(T)];
+            while (count < max && try_receive_sequenced(storage) == ResponseStatus::SUCCESS) {
+                *out = *std::launder(reinterpret_cast<T*>(storage));
+                ++out;
+                ++count;
+            }
+            return count;
+        } else {
+            if constexpr (Strategy == OverflowStrategy::OVERWRITE_ON_FULL) {
+                // Holding the flag for the whole run keeps the sender from overwriting any of it
+                bool isOccupied = oldestOccupied_.exchange(true, std::memory_order_acq_rel);
+                if (isOccupied) {
+                    return 0;
+                }
+            }
+
+            size_t rcvCursor = receiver_position();
+            drop_stale_cache(rcvCursor);
+            size_t ready = (sendCursorCache_ - rcvCursor) & capacity_mask_;
+
+            if (ready < max) {
+                // Refresh cache
+                sendCursorCache_ = sendCursor_.load(std::memory_order_acquire) & ~closed_bit;
+                ready = (sendCursorCache_ - rcvCursor) & capacity_mask_;
+            }
+
+            const size_t count = std::min(ready, max);
+            if (count == 0) {
                 if constexpr (Strategy == OverflowStrategy::OVERWRITE_ON_FULL) {
                     oldestOccupied_.store(false, std::memory_order_release);
                 }
+                stats_.empty();
+                return 0;
+            }
+
+            if constexpr (padded) {
+                // Padded slots are not contiguous values, they are moved one by one
+                for (size_t i = 0; i < count; ++i) {
+                    T* const value = slot((rcvCursor + i) & capacity_mask_);
+                    *out = std::move(*value);
+                    ++out;
+                    value->~T();
+                }
+            } else if constexpr (bulk_copyable && contiguous_run<It>) {
+                // Trivially destructible as well, nothing is left to destroy in the ring
+                const size_t head = std::min(count, capacity_ - rcvCursor);
+                std::memcpy(std::to_address(out), buffer_ + rcvCursor, head * sizeof(T));
+                std::memcpy(std::to_address(out) + head, buffer_, (count - head) * sizeof(T));
+                out += count;
+            } else {
+                // The run is split into at most two segments, the second one starts at the beginning of the ring
+                const size_t head = std::min(count, capacity_ - rcvCursor);
+                out = std::move(buffer_ + rcvCursor, buffer_ + rcvCursor + head, out);
+                std::destroy_n(buffer_ + rcvCursor, head);
+                out = std::move(buffer_, buffer_ + (count - head), out);
+                std::destroy_n(buffer_, count - head);
+            }
+
+            advance_receiver(rcvCursor, (rcvCursor + count) & capacity_mask_);
+            stats_.received(count);
 
-                return ResponseStatus::CHANNEL_EMPTY;
+            if constexpr (Strategy == OverflowStrategy::OVERWRITE_ON_FULL) {
+                oldestOccupied_.store(false, std::memory_order_release);
             }
+
+            return count;
         }
+    }
 
-        value = std::move(buffer_[rcvCursor]);
-        buffer_[rcvCursor].~T(); // Call destructor
+    /// @brief Reserve up to n free slots for writing in place
+    /// @param n Maximum number of slots to reserve
+    /// @return Reserved slots, empty if the channel is full
+    /// @note This function is lock-free and wait-free
+    RingSpan<T> reserve(const size_t n) noexcept requires (!padded) {
+        size_t sendCursor = sendCursor_.load(std::memory_order_relaxed); // only sender thread writes this
+        size_t free = (rcvCursorCache_ - sendCursor - 1) & capacity_mask_;
+
+        if (free < n) {
+            // Refresh the cache
+            const size_t rcvCursor = rcvCursor_.load(std::memory_order_acquire);
+            rcvCursorCache_ = rcvCursor & ~closed_bit;
+            if (rcvCursor & closed_bit) return {};
+            free = (rcvCursorCache_ - sendCursor - 1) & capacity_mask_;
+        }
+
+        const size_t count = std::min(n, free);
+        const size_t head = std::min(count, capacity_ - sendCursor);
+        return { { buffer_ + sendCursor, head }, { buffer_, count - head } };
+    }
+
+    /// @brief Publish n reserved slots to the receiver
+    /// @param n Number of slots to publish
+    /// @note This function is lock-free and wait-free
+    void commit(const size_t n) noexcept requires (!padded) {
+        size_t sendCursor = sendCursor_.load(std::memory_order_relaxed); // only sender thread writes this
+        sendCursor_.store((sendCursor + n) & capacity_mask_, std::memory_order_release);
+        stats_.sent(n);
+        record_depth((sendCursor + n) & capacity_mask_);
 
-        rcvCursor_.store(next_index(rcvCursor), std::memory_order_release);
-        
         if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
-            rcvCursor_.notify_one(); // Notify sender that a value has been received
+            sendCursor_.notify_one(); // Notify receiver that values have been sent
+        } else if constexpr (Wait == WaitStrategy::ADAPTIVE || Wait == WaitStrategy::ASYNC) {
+            if (parkers_.data.notify_one()) {
+                stats_.woke_receiver();
+            }
         }
-        
+    }
+
+    /// @brief Get the slots that are ready to be received
+    /// @return Ready slots, empty if the channel is empty
+    /// @note This function is lock-free and wait-free
+    RingSpan<T> peek() noexcept requires (!padded) {
+        size_t rcvCursor = receiver_position();
+
+        if (rcvCursor == sendCursorCache_) {
+            // Refresh cache
+            sendCursorCache_ = sendCursor_.load(std::memory_order_acquire) & ~closed_bit;
+        }
+
+        const size_t count = (sendCursorCache_ - rcvCursor) & capacity_mask_;
+        const size_t head = std::min(count, capacity_ - rcvCursor);
+        return { { buffer_ + rcvCursor, head }, { buffer_, count - head } };
+    }
+
+    /// @brief Destroy n peeked values and give their slots back to the sender
+    /// @param n Number of values to release
+    /// @note This function is lock-free and wait-free
+    void release(const size_t n) noexcept(std::is_nothrow_destructible_v<T>) requires (!padded) {
+        size_t rcvCursor = receiver_position();
+        const size_t head = std::min(n, capacity_ - rcvCursor);
+        std::destroy_n(buffer_ + rcvCursor, head);
+        std::destroy_n(buffer_, n - head);
+
+        advance_receiver(rcvCursor, (rcvCursor + n) & capacity_mask_);
+        stats_.received(n);
+    }
+
+    /// @brief Mark the sender as closed and wake up the receiver
+    /// @note Called by the sender thread, the sender must not use the channel afterwards
+    void close_sender() noexcept {
+        sendCursor_.fetch_or(closed_bit, std::memory_order_release);
+
+        if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
+            sendCursor_.notify_one(); // Notify receiver that the sender is gone
+        } else if constexpr (Wait == WaitStrategy::ADAPTIVE || Wait == WaitStrategy::ASYNC) {
+            if (parkers_.data.notify_one()) {
+                stats_.woke_receiver();
+            }
+        }
+    }
+
+    /// @brief Mark the receiver as closed and wake up the sender
+    /// @note Called by the receiver thread, the receiver must not use the channel afterwards
+    void close_receiver() noexcept {
+        if constexpr (Strategy == OverflowStrategy::OVERWRITE_ON_FULL) {
+            // The overwriting sender stores rcvCursor_ too, it does so only while holding the flag
+            while (oldestOccupied_.exchange(true, std::memory_order_acq_rel)) {
+                cpu_relax();
+            }
+        }
+
+        if constexpr (line_release) {
+            // Publish the slots held back as well, the channel destructor starts from the stored cursor
+            rcvCursor_.store(rcvPosition_ | closed_bit, std::memory_order_release);
+        } else {
+            rcvCursor_.fetch_or(closed_bit, std::memory_order_release);
+        }
+
         if constexpr (Strategy == OverflowStrategy::OVERWRITE_ON_FULL) {
             oldestOccupied_.store(false, std::memory_order_release);
         }
 
-        return ResponseStatus::SUCCESS;
+        if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
+            rcvCursor_.notify_one(); // Notify sender that the receiver is gone
+        } else if constexpr (Wait == WaitStrategy::ADAPTIVE || Wait == WaitStrategy::ASYNC) {
+            if (parkers_.space.notify_one()) {
+                stats_.woke_sender();
+            }
+        }
+    }
+
+    /// @brief Check if the sender was closed
+    bool sender_closed() const noexcept {
+        return sendCursor_.load(std::memory_order_acquire) & closed_bit;
+    }
+
+    /// @brief Check if the receiver was closed
+    bool receiver_closed() const noexcept {
+        return rcvCursor_.load(std::memory_order_acquire) & closed_bit;
+    }
+
+    /// @brief Snapshot of the counters kept by the Stats policy
+    channel_stats stats() const noexcept requires (Stats::enabled) {
+        return stats_.snapshot();
+    }
+
+    /// @brief Report a slow path event with the current depth of the channel, compiled out unless CHANNELS_TRACE is set
+    inline void trace(const TraceEvent event, const ResponseStatus status) const noexcept {
+        if constexpr (CHANNELS_TRACE != 0) {
+            const size_t sendCursor = sendCursor_.load(std::memory_order_relaxed) & ~closed_bit;
+            const size_t rcvCursor = rcvCursor_.load(std::memory_order_relaxed) & ~closed_bit;
+            // Sequenced cursors count messages, the others are ring indexes
+            const uint64_t depth = sequenced ? std::min<uint64_t>(sendCursor - rcvCursor, capacity_) : (sendCursor - rcvCursor) & capacity_mask_;
+            __trace::emit(event, this, status, depth, capacity_);
+        }
+    }
+
+    /// @brief Check if there is a value to receive or the sender was closed
+    /// @note Called by the receiver thread
+    bool ready_to_receive() const noexcept {
+        return sendCursor_.load(std::memory_order_acquire) != receiver_position();
+    }
+
+    /// @brief Register a selector to be signalled when the sender publishes a value or closes
+    /// @return false if there is something to receive already and the selector is not registered
+    bool arm_selector(__select_hook* hook) noexcept requires (Wait == WaitStrategy::ADAPTIVE) {
+        return parkers_.data.arm(hook, [this]() noexcept { return ready_to_receive(); });
+    }
+
+    /// @brief Unregister the selector
+    /// @return false if the sender is signalling it right now
+    bool disarm_selector() noexcept requires (Wait == WaitStrategy::ADAPTIVE) {
+        return parkers_.data.disarm();
+    }
+
+    /// @brief Suspend the receiving coroutine until the sender publishes a value or closes
+    /// @return false if there is something to receive already and the coroutine must not suspend
+    /// @note Called by the receiver after try_receive reported CHANNEL_EMPTY, which refreshed sendCursorCache_
+    /// @note The cache is copied first, once the waker is published the coroutine may already run on the notifier thread
+    bool park_receiver(__waker* waker) noexcept requires (Wait == WaitStrategy::ASYNC) {
+        const size_t sendCursorCache = sendCursorCache_;
+        return parkers_.data.park(waker, [this, sendCursorCache]() noexcept {
+            return sendCursor_.load(std::memory_order_acquire) != sendCursorCache;
+        });
+    }
+
+    /// @brief Suspend the sending coroutine until the receiver frees a slot or closes
+    /// @return false if there is free space already and the coroutine must not suspend
+    /// @note Called by the sender after try_send reported CHANNEL_FULL, which refreshed rcvCursorCache_
+    bool park_sender(__waker* waker) noexcept requires (Wait == WaitStrategy::ASYNC) {
+        const size_t rcvCursorCache = rcvCursorCache_;
+        return parkers_.space.park(waker, [this, rcvCursorCache]() noexcept {
+            return rcvCursor_.load(std::memory_order_acquire) != rcvCursorCache;
+        });
     }
 
 private:
+    /// @brief Set in a cursor by its owner when it closes
+    /// Indices never reach it, so ordinary cursor stores can not clear it, and the opposite side
+    /// only sees it when it refreshes its cache, which keeps close checks off the fast path.
+    /// Changing the cursor also wakes up threads waiting on it.
+    static constexpr size_t closed_bit = ~(~size_t(0) >> 1);
+
+    /// @brief Try to send a run of values with WAIT_ON_FULL strategy
+    template<std::forward_iterator It>
+    inline size_t try_send_n_wait_on_full(It& first, const It last) noexcept(std::is_nothrow_constructible_v<T, std::iter_reference_t<It>>) {
+        const size_t requested = static_cast<size_t>(std::distance(first, last));
+        if (requested == 0) return 0;
+
+        size_t sendCursor = sendCursor_.load(std::memory_order_relaxed); // only sender thread writes this
+        size_t free = (rcvCursorCache_ - sendCursor - 1) & capacity_mask_;
+
+        if (free < requested) {
+            // Refresh the cache
+            const size_t rcvCursor = rcvCursor_.load(std::memory_order_acquire);
+            rcvCursorCache_ = rcvCursor & ~closed_bit;
+            if (rcvCursor & closed_bit) return 0;
+            free = (rcvCursorCache_ - sendCursor - 1) & capacity_mask_;
+            if (free == 0) {
+                stats_.full();
+                return 0;
+            }
+        }
+
+        const size_t count = std::min(requested, free);
+        if constexpr (padded) {
+            // Padded slots are not contiguous values, they are constructed one by one
+            size_t i = 0;
+            if constexpr (std::is_nothrow_constructible_v<T, std::iter_reference_t<It>>) {
+                for (; i < count; ++i, ++first) {
+                    new (storage((sendCursor + i) & capacity_mask_)) T(*first);
+                }
+            } else {
+                try {
+                    for (; i < count; ++i, ++first) {
+                        new (storage((sendCursor + i) & capacity_mask_)) T(*first);
+                    }
+                } catch (...) {
+                    // Nothing was published yet so the constructed values have to be cleaned up here
+                    while (i > 0) {
+                        --i;
+                        slot((sendCursor + i) & capacity_mask_)->~T();
+                    }
+                    throw;
+                }
+            }
+        } else if constexpr (bulk_copyable && contiguous_run<It>) {
+            // The run is split into at most two segments, the second one starts at the beginning of the ring
+            const size_t head = std::min(count, capacity_ - sendCursor);
+            const T* const values = std::to_address(first);
+            copy_to_ring(buffer_ + sendCursor, values, head);
+            copy_to_ring(buffer_, values + head, count - head);
+            first += count;
+        } else {
+            // The run is split into at most two segments, the second one starts at the beginning of the ring
+            const size_t head = std::min(count, capacity_ - sendCursor);
+            T* const tail = buffer_ + sendCursor;
+
+            first = std::ranges::uninitialized_copy_n(first, head, tail, tail + head).in;
+            if constexpr (std::is_nothrow_constructible_v<T, std::iter_reference_t<It>>) {
+                first = std::ranges::uninitialized_copy_n(first, count - head, buffer_, buffer_ + (count - head)).in;
+            } else {
+                try {
+                    first = std::ranges::uninitialized_copy_n(first, count - head, buffer_, buffer_ + (count - head)).in;
+                } catch (...) {
+                    // Nothing was published yet so the first segment has to be cleaned up here
+                    std::destroy_n(tail, head);
+                    throw;
+                }
+            }
+        }
+
+        sendCursor_.store((sendCursor + count) & capacity_mask_, std::memory_order_release);
+        stats_.sent(count);
+        record_depth((sendCursor + count) & capacity_mask_);
+
+        if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
+            sendCursor_.notify_one(); // Notify receiver that values have been sent
+        } else if constexpr (Wait == WaitStrategy::ADAPTIVE || Wait == WaitStrategy::ASYNC) {
+            if (parkers_.data.notify_one()) {
+                stats_.woke_receiver();
+            }
+        }
+
+        return count;
+    }
+
+    /// @brief Copy n trivially copyable values into free slots
+    /// @note Rings of at least CHANNELS_STREAMING_STORE_BYTES are written with non-temporal stores, which are fenced here,
+    /// so the release store of the cursor publishes them
+    inline void copy_to_ring(T* const slots, const T* const values, const size_t n) noexcept {
+        if constexpr (CHANNELS_STREAMING_STORE_BYTES != 0) {
+            if (capacity_ * sizeof(T) >= CHANNELS_STREAMING_STORE_BYTES) {
+                __stream_copy(slots, values, n * sizeof(T));
+                __stream_fence();
+                return;
+            }
+        }
+        std::memcpy(slots, values, n * sizeof(T));
+    }
+
     /// @brief Try to send with WAIT_ON_FULL strategy (original behavior)
     template<typename U>
     inline ResponseStatus try_send_wait_on_full(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&>) {
@@ -301,17 +1286,28 @@ private:
 
         if (next_sendCursor == rcvCursorCache_) {
             // Refresh the cache
-            rcvCursorCache_ = rcvCursor_.load(std::memory_order_acquire);
-            if (next_sendCursor == rcvCursorCache_) return ResponseStatus::CHANNEL_FULL;
+            const size_t rcvCursor = rcvCursor_.load(std::memory_order_acquire);
+            rcvCursorCache_ = rcvCursor & ~closed_bit;
+            if (rcvCursor & closed_bit) return ResponseStatus::CHANNEL_CLOSED;
+            if (next_sendCursor == rcvCursorCache_) {
+                stats_.full();
+                return ResponseStatus::CHANNEL_FULL;
+            }
         }
 
         // Construct the new element in place
-        new (&buffer_[sendCursor]) T(std::forward<U>(value));
+        new (storage(sendCursor)) T(std::forward<U>(value));
         
         sendCursor_.store(next_sendCursor, std::memory_order_release);
+        stats_.sent(1);
+        record_depth(next_sendCursor);
 
         if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
             sendCursor_.notify_one(); // Notify receiver that a value has been sent
+        } else if constexpr (Wait == WaitStrategy::ADAPTIVE || Wait == WaitStrategy::ASYNC) {
+            if (parkers_.data.notify_one()) {
+                stats_.woke_receiver();
+            }
         }
 
         return ResponseStatus::SUCCESS;
@@ -325,20 +1321,30 @@ private:
 
         if (next_sendCursor == rcvCursorCache_) {
             // Refresh the cache
-            rcvCursorCache_ = rcvCursor_.load(std::memory_order_acquire);
+            const size_t rcvCursor = rcvCursor_.load(std::memory_order_acquire);
+            rcvCursorCache_ = rcvCursor & ~closed_bit;
+            if (rcvCursor & closed_bit) return ResponseStatus::CHANNEL_CLOSED;
             if (next_sendCursor == rcvCursorCache_) {
                 bool isOldestOccupied = oldestOccupied_.exchange(true, std::memory_order_acq_rel);
                 if (isOldestOccupied) {
                     // If the oldest element is occupied, we cannot overwrite
+                    stats_.send_skipped();
                     return ResponseStatus::SKIP_DUE_TO_OVERWRITE;
                 }
 
                 size_t newestRcvCursor = rcvCursor_.load(std::memory_order_acquire);
+                if (newestRcvCursor & closed_bit) {
+                    // The receiver closes while holding the flag, so its bit can not be overwritten below
+                    oldestOccupied_.store(false, std::memory_order_release);
+                    return ResponseStatus::CHANNEL_CLOSED;
+                }
 
                 /// If the receiver did not advance, we can safely advance the cursor
                 if (rcvCursorCache_ == newestRcvCursor) {
+                    slot(newestRcvCursor)->~T(); // The receiver can not be reading it while the flag is held
                     rcvCursorCache_ = next_index(newestRcvCursor);
                     rcvCursor_.store(rcvCursorCache_, std::memory_order_release);
+                    stats_.overwritten();
                 } else {
                     rcvCursorCache_ = newestRcvCursor;
                 }
@@ -348,28 +1354,106 @@ private:
         }
 
         // Normal case: buffer not full
-        new (&buffer_[sendCursor]) T(std::forward<U>(value));
+        new (storage(sendCursor)) T(std::forward<U>(value));
         sendCursor_.store(next_sendCursor, std::memory_order_release);
+        stats_.sent(1);
+        record_depth(next_sendCursor);
         
         if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
             sendCursor_.notify_one(); // Notify receiver that a value has been sent
+        } else if constexpr (Wait == WaitStrategy::ADAPTIVE || Wait == WaitStrategy::ASYNC) {
+            if (parkers_.data.notify_one()) {
+                stats_.woke_receiver();
+            }
         }
         
         return ResponseStatus::SUCCESS;
     }
 
-    /// @brief Calculate the next power of 2 greater than or equal to n
-    /// @param n The input value
-    /// @return The next power of 2
-    static constexpr size_t next_power_of_2(const size_t n) noexcept {
-        if (n <= 1) return 1;
-        
-        // Use bit manipulation for efficiency
-        size_t power = 1;
-        while (power < n) {
-            power <<= 1;
+    /// @brief Try to send with OVERWRITE_SEQUENCED strategy, never fails unless the receiver is closed
+    /// @note The receiver cursor is not needed to decide anything, it is checked for the closed bit once per lap
+    template<typename U>
+    inline ResponseStatus try_send_sequenced(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&>) {
+        const size_t sendCursor = sendCursor_.load(std::memory_order_relaxed); // only sender thread writes this
+
+        if ((sendCursor & capacity_mask_) == 0) {
+            const size_t rcvCursor = rcvCursor_.load(std::memory_order_acquire);
+            if (rcvCursor & closed_bit) return ResponseStatus::CHANNEL_CLOSED;
+            rcvCursorCache_ = rcvCursor;
+        }
+
+        if constexpr (std::is_same_v<std::remove_cvref_t<U>, T>) {
+            buffer_[sendCursor & capacity_mask_].store(value, sendCursor);
+        } else {
+            buffer_[sendCursor & capacity_mask_].store(T(std::forward<U>(value)), sendCursor);
+        }
+
+        sendCursor_.store(sendCursor + 1, std::memory_order_release);
+        stats_.sent(1);
+        record_depth(sendCursor + 1);
+
+        if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
+            sendCursor_.notify_one(); // Notify receiver that a value has been sent
+        } else if constexpr (Wait == WaitStrategy::ADAPTIVE || Wait == WaitStrategy::ASYNC) {
+            if (parkers_.data.notify_one()) {
+                stats_.woke_receiver();
+            }
+        }
+
+        return ResponseStatus::SUCCESS;
+    }
+
+    /// @brief Try to receive with OVERWRITE_SEQUENCED strategy
+    /// Only loads on the fast path, a slot whose stamp moved was overwritten and the receiver jumps to the oldest value
+    /// the sender can not have overwritten yet, so every retry makes progress even with the sender stalled mid-write.
+    /// @param out Storage for a T, written with memcpy
+    inline ResponseStatus try_receive_sequenced(void* out) noexcept {
+        size_t rcvCursor = rcvCursor_.load(std::memory_order_relaxed); // only receiver thread writes this
+
+        for (;;) {
+            if (rcvCursor == sendCursorCache_) {
+                // Refresh cache
+                const size_t sendCursor = sendCursor_.load(std::memory_order_acquire);
+                sendCursorCache_ = sendCursor & ~closed_bit;
+                if (rcvCursor == sendCursorCache_) {
+                    if (sendCursor & closed_bit) {
+                        return ResponseStatus::SENDER_CLOSED;
+                    }
+                    stats_.empty();
+                    return ResponseStatus::CHANNEL_EMPTY;
+                }
+            }
+
+            if (sendCursorCache_ - rcvCursor > capacity_) {
+                // Lapped, only the last capacity_ messages can still be in the ring
+                stats_.lapped(sendCursorCache_ - capacity_ - rcvCursor);
+                rcvCursor = sendCursorCache_ - capacity_;
+            }
+
+            const uint64_t stamp = buffer_[rcvCursor & capacity_mask_].load(out, rcvCursor);
+            if (stamp == 2 * uint64_t(rcvCursor) + 2) {
+                rcvCursor_.store(rcvCursor + 1, std::memory_order_release);
+                stats_.received(1);
+                return ResponseStatus::SUCCESS;
+            }
+
+            // Message (stamp - 1) / 2 is in this slot now, everything older than its lap is gone
+            const size_t oldest = static_cast<size_t>((stamp - 1) / 2) - capacity_ + 1;
+            stats_.lapped(oldest - rcvCursor);
+            rcvCursor = oldest;
+            rcvCursor_.store(rcvCursor, std::memory_order_relaxed);
+            sendCursorCache_ = sendCursor_.load(std::memory_order_acquire) & ~closed_bit;
+        }
+    }
+
+    /// @brief Report the number of values in the channel after a publish
+    /// @note Computed from the cached receiver cursor, so it may overestimate but it costs no shared load
+    inline void record_depth(const size_t sendCursor) noexcept {
+        if constexpr (Stats::enabled && sequenced) {
+            stats_.depth(std::min(sendCursor - rcvCursorCache_, capacity_));
+        } else if constexpr (Stats::enabled) {
+            stats_.depth((sendCursor - rcvCursorCache_) & capacity_mask_);
         }
-        return power;
     }
 
     /// @brief Get the next index in a circular buffer
@@ -380,9 +1464,74 @@ private:
         return (val + 1) & capacity_mask_;
     }
 
-    const size_t capacity_;
-    const size_t capacity_mask_; // mask for bitwise next_index
-    T* buffer_;
+    /// @brief Get the value stored in the slot at index i
+    inline T* slot(const size_t i) noexcept {
+        if constexpr (padded) {
+            return std::launder(reinterpret_cast<T*>(buffer_[i].bytes));
+        } else {
+            return buffer_ + i;
+        }
+    }
+
+    /// @brief Get the raw storage of the slot at index i, for constructing a value
+    inline void* storage(const size_t i) noexcept {
+        if constexpr (padded) {
+            return buffer_[i].bytes;
+        } else {
+            return buffer_ + i;
+        }
+    }
+
+    /// @brief Get the index of the next slot to receive
+    /// @note Called by the receiver thread, with LINE_RELEASE rcvCursor_ may lag behind it
+    inline size_t receiver_position() const noexcept {
+        if constexpr (line_release) {
+            return rcvPosition_;
+        } else {
+            return rcvCursor_.load(std::memory_order_relaxed); // only receiver thread writes this
+        }
+    }
+
+    /// @brief Invalidate the cached sender cursor if the overwriting sender moved rcvCursor_ since the last receive
+    /// @param rcvCursor Receiver cursor loaded while holding oldestOccupied_
+    /// @note Dropping values moves rcvCursor_ forward, possibly past the cached sender cursor, which would make
+    /// the slot the sender is still writing look ready. Called by the receiver thread.
+    inline void drop_stale_cache(const size_t rcvCursor) noexcept {
+        if constexpr (Strategy == OverflowStrategy::OVERWRITE_ON_FULL) {
+            if (rcvCursor != rcvPosition_) [[ unlikely ]] {
+                rcvPosition_ = rcvCursor;
+                sendCursorCache_ = rcvCursor; // reads as empty, so the next check refreshes it
+            }
+        }
+    }
+
+    /// @brief Give the slots from rcvCursor up to next back to the sender and wake it up
+    /// @note LINE_RELEASE stores and notifies only when next is in another line of slots than rcvCursor,
+    /// it publishes the start of that line, so the sender never writes into the line being read
+    inline void advance_receiver(const size_t rcvCursor, const size_t next) noexcept {
+        size_t published = next;
+        if constexpr (Strategy == OverflowStrategy::OVERWRITE_ON_FULL) {
+            rcvPosition_ = next;
+        }
+        if constexpr (line_release) {
+            rcvPosition_ = next;
+            // A run wrapping around the ring ends below rcvCursor, it always leaves the line
+            if (((rcvCursor ^ next) & ~(slots_per_line - 1)) == 0 && next >= rcvCursor) {
+                return;
+            }
+            published = next & ~(slots_per_line - 1);
+        }
+
+        rcvCursor_.store(published, std::memory_order_release);
+
+        if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
+            rcvCursor_.notify_one(); // Notify sender that values have been received
+        } else if constexpr (Wait == WaitStrategy::ADAPTIVE || Wait == WaitStrategy::ASYNC) {
+            if (parkers_.space.notify_one()) {
+                stats_.woke_sender();
+            }
+        }
+    }
 
     /// Producer-side data (accessed by sender thread)
     alignas(cache_line_size) std::atomic<size_t> sendCursor_{0};
@@ -391,12 +1540,19 @@ private:
     /// Consumer-side data (accessed by receiver thread)  
     alignas(cache_line_size) std::atomic<size_t> rcvCursor_{0};
     alignas(cache_line_size) size_t sendCursorCache_{0}; // reduces cache coherency
+    size_t rcvPosition_{0}; // next slot to receive, published to rcvCursor_ line by line with LINE_RELEASE, with OVERWRITE_ON_FULL the last rcvCursor_ the receiver stored
 
     /// Flag indicating if the oldest element is occupied
     alignas(cache_line_size) std::atomic<bool> oldestOccupied_{false};
 
-    friend class Sender<T, Strategy, Wait>;
-    friend class Receiver<T, Strategy, Wait>;
+    /// Threads parked by the ADAPTIVE strategy
+    [[no_unique_address]] __wait_parkers<Wait> parkers_;
+
+    /// Counters of the Stats policy, empty by default
+    [[no_unique_address]] Stats stats_;
+
+    friend class Sender<T, Strategy, Wait, Allocator, Stats, Layout>;
+    friend class Receiver<T, Strategy, Wait, Allocator, Stats, Layout>;
 };
 
 
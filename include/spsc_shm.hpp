@@ -0,0 +1,438 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Inter-Process Shared Memory SPSC Channel Implementation
+ *
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <channels.hpp>
+
+namespace channels::spsc::shm {
+
+
+/// @brief Magic number stored at the beginning of every shared memory channel ("CHANSPSC")
+constexpr uint64_t layout_magic = 0x4348414e53505343ull;
+
+/// @brief Version of the shared memory layout, it is bumped on every incompatible change
+constexpr uint32_t layout_version = 1;
+
+template<typename T, WaitStrategy Wait>
+class Sender;
+template<typename T, WaitStrategy Wait>
+class Receiver;
+template<typename T>
+struct InnerChannel;
+
+/// @brief Shared part of the channel placed at the beginning of the shared memory segment
+/// @tparam T The type of values sent through the channel
+/// It has the same layout as spsc::InnerChannel but it does not own the buffer, the ring follows it in the segment.
+/// Every process maps it at a different address so it does not contain any pointers.
+/// @note This struct is not intended to be used directly by users
+template <typename T>
+struct InnerChannel {
+    std::atomic<uint64_t> magic;
+    uint32_t version;
+    uint32_t valueSize;
+    uint32_t valueAlignment;
+    size_t capacity;
+    size_t capacityMask;
+
+    /// Producer-side data (accessed by sender process)
+    alignas(cache_line_size) std::atomic<size_t> sendCursor{0};
+    alignas(cache_line_size) size_t rcvCursorCache{0}; // reduces cache coherency
+
+    /// Consumer-side data (accessed by receiver process)
+    alignas(cache_line_size) std::atomic<size_t> rcvCursor{0};
+    alignas(cache_line_size) size_t sendCursorCache{0}; // reduces cache coherency
+
+    /// @brief Offset of the ring from the beginning of the segment
+    static constexpr size_t buffer_offset() noexcept {
+        return (sizeof(InnerChannel) + alignof(T) - 1) / alignof(T) * alignof(T);
+    }
+
+    inline T* buffer() noexcept {
+        return std::launder(reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(this) + buffer_offset()));
+    }
+};
+
+/// @brief RAII handle of a mapped POSIX shared memory segment
+/// @note The handle that created the segment removes its name when it is destroyed,
+/// processes that already opened it can still use it.
+/// @note This class is not intended to be used directly by users
+class SharedMemory {
+public:
+    SharedMemory() noexcept = default;
+    SharedMemory(const SharedMemory&) = delete;
+    SharedMemory& operator=(const SharedMemory&) = delete;
+
+    SharedMemory(SharedMemory&& other) noexcept :
+        address_(other.address_), length_(other.length_), name_(std::move(other.name_)), owner_(other.owner_) {
+        other.address_ = nullptr;
+        other.owner_ = false;
+    }
+
+    SharedMemory& operator=(SharedMemory&& other) noexcept {
+        if (this != &other) {
+            release();
+            address_ = other.address_;
+            length_ = other.length_;
+            name_ = std::move(other.name_);
+            owner_ = other.owner_;
+            other.address_ = nullptr;
+            other.owner_ = false;
+        }
+        return *this;
+    }
+
+    ~SharedMemory() noexcept {
+        release();
+    }
+
+    /// @brief Create a new segment, it fails if the segment with given name already exists
+    static SharedMemory create(const std::string& name, const size_t length) {
+        int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0) {
+            throw std::system_error(errno, std::generic_category(), "shm_open failed for " + name);
+        }
+        if (::ftruncate(fd, static_cast<off_t>(length)) != 0) {
+            int error = errno;
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            throw std::system_error(error, std::generic_category(), "ftruncate failed for " + name);
+        }
+        SharedMemory memory;
+        try {
+            memory = map(fd, length, name);
+        } catch (...) {
+            ::shm_unlink(name.c_str()); // nothing owns the name yet, the next create would fail with EEXIST
+            throw;
+        }
+        memory.owner_ = true;
+        return memory;
+    }
+
+    /// @brief Open an existing segment
+    static SharedMemory open(const std::string& name) {
+        int fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+        if (fd < 0) {
+            throw std::system_error(errno, std::generic_category(), "shm_open failed for " + name);
+        }
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "fstat failed for " + name);
+        }
+        return map(fd, static_cast<size_t>(info.st_size), name);
+    }
+
+    inline void* address() const noexcept {
+        return address_;
+    }
+
+    inline size_t length() const noexcept {
+        return length_;
+    }
+
+private:
+    void* address_{nullptr};
+    size_t length_{0};
+    std::string name_;
+    bool owner_{false};
+
+    static SharedMemory map(int fd, const size_t length, const std::string& name) {
+        void* address = length == 0 ? MAP_FAILED : ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int error = errno;
+        ::close(fd); // mapping stays valid after closing the descriptor
+        if (address == MAP_FAILED) {
+            throw std::system_error(length == 0 ? EINVAL : error, std::generic_category(), "mmap failed for " + name);
+        }
+        SharedMemory memory;
+        memory.address_ = address;
+        memory.length_ = length;
+        memory.name_ = name;
+        return memory;
+    }
+
+    void release() noexcept {
+        if (address_) {
+            ::munmap(address_, length_);
+            address_ = nullptr;
+        }
+        if (owner_) {
+            ::shm_unlink(name_.c_str());
+            owner_ = false;
+        }
+    }
+};
+
+/// @brief Remove the name of a shared memory channel, for example one left behind by a crashed process
+/// @param name Name of the segment
+/// @return True if the name was removed
+/// @note Processes that already mapped the channel can still use it
+inline bool remove(const std::string& name) noexcept {
+    return ::shm_unlink(name.c_str()) == 0;
+}
+
+/// @brief Calculate the next power of 2 greater than or equal to n
+/// @param n The input value
+/// @return The next power of 2
+/// @note This function is not intended to be used directly by users
+constexpr size_t next_power_of_2(const size_t n) noexcept {
+    if (n <= 1) return 1;
+
+    size_t power = 1;
+    while (power < n) {
+        power <<= 1;
+    }
+    return power;
+}
+
+/// @brief Create the shared memory segment and initialize the channel in it
+/// @note This function is not intended to be used directly by users
+template <typename T>
+SharedMemory create_channel(const std::string& name, const size_t capacity) {
+    const size_t realCapacity = next_power_of_2(capacity);
+    SharedMemory memory = SharedMemory::create(name, InnerChannel<T>::buffer_offset() + realCapacity * sizeof(T));
+
+    InnerChannel<T>* channel = new (memory.address()) InnerChannel<T>{};
+    channel->version = layout_version;
+    channel->valueSize = sizeof(T);
+    channel->valueAlignment = alignof(T);
+    channel->capacity = realCapacity;
+    channel->capacityMask = realCapacity - 1;
+    // Magic is stored last so the other process never sees half initialized channel
+    channel->magic.store(layout_magic, std::memory_order_release);
+    return memory;
+}
+
+/// @brief Open the shared memory segment and check that its layout matches this build
+/// @note This function is not intended to be used directly by users
+template <typename T>
+SharedMemory open_channel(const std::string& name) {
+    SharedMemory memory = SharedMemory::open(name);
+    if (memory.length() < sizeof(InnerChannel<T>)) {
+        throw std::runtime_error("shared memory channel " + name + " is not initialized");
+    }
+
+    InnerChannel<T>* channel = std::launder(static_cast<InnerChannel<T>*>(memory.address()));
+    if (channel->magic.load(std::memory_order_acquire) != layout_magic) {
+        throw std::runtime_error("shared memory segment " + name + " is not an initialized channel");
+    }
+    if (channel->version != layout_version) {
+        throw std::runtime_error("shared memory channel " + name + " has incompatible layout version " + std::to_string(channel->version));
+    }
+    if (channel->valueSize != sizeof(T) || channel->valueAlignment != alignof(T)
+        || memory.length() < InnerChannel<T>::buffer_offset() + channel->capacity * sizeof(T)) {
+        throw std::runtime_error("shared memory channel " + name + " holds values of different type");
+    }
+    return memory;
+}
+
+/// @brief Sender for an inter-process single-producer, single-consumer channel
+/// @tparam T The type of values sent through the channel, it has to be trivially copyable
+/// @tparam Wait The wait strategy used when the channel is full (ATOMIC_WAIT is not supported across processes)
+/// It allows to send values to the channel. It is designed to be used only from one thread of one process at a time.
+template <typename T, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
+class Sender {
+    static_assert(std::is_trivially_copyable_v<T>, "Values sent between processes have to be trivially copyable");
+    static_assert(std::atomic<size_t>::is_always_lock_free, "Cursors have to be lock-free to be shared between processes");
+    static_assert(Wait == WaitStrategy::BUSY_LOOP || Wait == WaitStrategy::YIELD, "ATOMIC_WAIT, ADAPTIVE and ASYNC can not wake up waiters in other processes");
+
+    explicit Sender(SharedMemory memory) noexcept :
+        memory_(std::move(memory)), channel_(std::launder(static_cast<InnerChannel<T>*>(memory_.address()))) {}
+public:
+    /// @brief Default constructor
+    /// @note required to have sender as class member
+    Sender() noexcept = default;
+    Sender(const Sender&) = delete;
+    Sender& operator=(const Sender&) = delete;
+    Sender(Sender&& other) noexcept = default;
+    Sender& operator=(Sender&& other) noexcept = default;
+
+    /// @brief Create a new channel in a named shared memory segment
+    /// @param name Name of the segment, it should start with '/'
+    /// @param capacity The minimum capacity of the channel, real capacity will be equal to the closest higher or equal power of two - 1
+    /// @return Sender of the created channel
+    /// @note The name is removed when the returned sender is destroyed
+    /// @throws std::system_error if the segment can not be created or mapped
+    static Sender create(const std::string& name, size_t capacity) {
+        return Sender(create_channel<T>(name, capacity));
+    }
+
+    /// @brief Open an existing channel from a named shared memory segment
+    /// @param name Name of the segment
+    /// @return Sender of the opened channel
+    /// @throws std::system_error if the segment can not be opened or mapped
+    /// @throws std::runtime_error if the segment does not hold a channel of this layout version and value type
+    static Sender open(const std::string& name) {
+        return Sender(open_channel<T>(name));
+    }
+
+    /// @brief Try to send a value to the channel
+    /// @param value The value to send
+    /// @return ResponseStatus indicating the result of the operation
+    /// @note This function is lock-free and wait-free
+    ResponseStatus try_send(const T& value) noexcept {
+        size_t sendCursor = channel_->sendCursor.load(std::memory_order_relaxed); // only sender writes this
+        size_t next_sendCursor = (sendCursor + 1) & channel_->capacityMask;
+
+        if (next_sendCursor == channel_->rcvCursorCache) {
+            // Refresh the cache
+            channel_->rcvCursorCache = channel_->rcvCursor.load(std::memory_order_acquire);
+            if (next_sendCursor == channel_->rcvCursorCache) return ResponseStatus::CHANNEL_FULL;
+        }
+
+        new (&channel_->buffer()[sendCursor]) T(value);
+        channel_->sendCursor.store(next_sendCursor, std::memory_order_release);
+
+        return ResponseStatus::SUCCESS;
+    }
+
+    /// @brief Send a value to the channel
+    /// @param value The value to send
+    /// @note This function is blocking and will wait until the value is sent.
+    void send(const T& value) noexcept {
+        if (try_send(value) != ResponseStatus::SUCCESS) [[ unlikely ]] {
+            do {
+                if constexpr (Wait == WaitStrategy::YIELD) {
+                    std::this_thread::yield(); // Yield to allow other threads to run
+                } else if constexpr (Wait == WaitStrategy::BUSY_LOOP) {
+                    asm volatile ("" ::: "memory"); // Busy loop, just spin with compiler barrier
+                }
+            } while (try_send(value) != ResponseStatus::SUCCESS);
+        }
+    }
+
+    /// @brief Layout version of the mapped channel
+    inline uint32_t version() const noexcept {
+        return channel_->version;
+    }
+
+private:
+    SharedMemory memory_;
+    InnerChannel<T>* channel_{nullptr};
+};
+
+/// @brief Receiver for an inter-process single-producer, single-consumer channel
+/// @tparam T The type of values sent through the channel, it has to be trivially copyable
+/// @tparam Wait The wait strategy used when the channel is empty (ATOMIC_WAIT is not supported across processes)
+/// It allows to receive values from the channel. It is designed to be used only from one thread of one process at a time.
+template <typename T, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
+class Receiver {
+    static_assert(std::is_trivially_copyable_v<T>, "Values sent between processes have to be trivially copyable");
+    static_assert(std::atomic<size_t>::is_always_lock_free, "Cursors have to be lock-free to be shared between processes");
+    static_assert(Wait == WaitStrategy::BUSY_LOOP || Wait == WaitStrategy::YIELD, "ATOMIC_WAIT, ADAPTIVE and ASYNC can not wake up waiters in other processes");
+
+    explicit Receiver(SharedMemory memory) noexcept :
+        memory_(std::move(memory)), channel_(std::launder(static_cast<InnerChannel<T>*>(memory_.address()))) {}
+public:
+    /// @brief Default constructor
+    /// @note required to have receiver as class member
+    Receiver() noexcept = default;
+    Receiver(const Receiver&) = delete;
+    Receiver& operator=(const Receiver&) = delete;
+    Receiver(Receiver&& other) noexcept = default;
+    Receiver& operator=(Receiver&& other) noexcept = default;
+
+    /// @brief Create a new channel in a named shared memory segment
+    /// @param name Name of the segment, it should start with '/'
+    /// @param capacity The minimum capacity of the channel, real capacity will be equal to the closest higher or equal power of two - 1
+    /// @return Receiver of the created channel
+    /// @note The name is removed when the returned receiver is destroyed
+    /// @throws std::system_error if the segment can not be created or mapped
+    static Receiver create(const std::string& name, size_t capacity) {
+        return Receiver(create_channel<T>(name, capacity));
+    }
+
+    /// @brief Open an existing channel from a named shared memory segment
+    /// @param name Name of the segment
+    /// @return Receiver of the opened channel
+    /// @throws std::system_error if the segment can not be opened or mapped
+    /// @throws std::runtime_error if the segment does not hold a channel of this layout version and value type
+    static Receiver open(const std::string& name) {
+        return Receiver(open_channel<T>(name));
+    }
+
+    /// @brief Try to receive a value from the channel
+    /// @param value The variable to store the received value
+    /// @return ResponseStatus indicating the result of the operation
+    /// @note This function is lock-free and wait-free
+    ResponseStatus try_receive(T& value) noexcept {
+        size_t rcvCursor = channel_->rcvCursor.load(std::memory_order_relaxed); // only receiver writes this
+
+        if (rcvCursor == channel_->sendCursorCache) {
+            // Refresh cache
+            channel_->sendCursorCache = channel_->sendCursor.load(std::memory_order_acquire);
+            if (rcvCursor == channel_->sendCursorCache) return ResponseStatus::CHANNEL_EMPTY;
+        }
+
+        value = channel_->buffer()[rcvCursor];
+        channel_->rcvCursor.store((rcvCursor + 1) & channel_->capacityMask, std::memory_order_release);
+
+        return ResponseStatus::SUCCESS;
+    }
+
+    /// @brief Receive a value from the channel
+    /// @return The received value
+    /// @note This function is blocking and will wait until a value is available.
+    T receive() noexcept {
+        T value;
+        if (try_receive(value) != ResponseStatus::SUCCESS) [[ unlikely ]] {
+            do {
+                if constexpr (Wait == WaitStrategy::YIELD) {
+                    std::this_thread::yield(); // Yield to allow other threads to run
+                } else if constexpr (Wait == WaitStrategy::BUSY_LOOP) {
+                    asm volatile ("" ::: "memory"); // Busy loop, just spin with compiler barrier
+                }
+            } while (try_receive(value) != ResponseStatus::SUCCESS);
+        }
+        return value;
+    }
+
+    /// @brief Layout version of the mapped channel
+    inline uint32_t version() const noexcept {
+        return channel_->version;
+    }
+
+private:
+    SharedMemory memory_;
+    InnerChannel<T>* channel_{nullptr};
+};
+
+
+} // namespace channels::spsc::shm
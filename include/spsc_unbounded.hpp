@@ -0,0 +1,339 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Unbounded Single Producer Single Consumer (SPSC) Channel Implementation
+ *
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <algorithm>
+#include <thread>
+#include <type_traits>
+
+#include <channels.hpp>
+
+namespace channels::spsc::unbounded {
+
+
+template<typename T, WaitStrategy Wait>
+class Sender;
+template<typename T, WaitStrategy Wait>
+class Receiver;
+template<typename T, WaitStrategy Wait>
+class InnerChannel;
+
+/// @brief Create an unbounded single-producer, single-consumer channel
+/// @param segment_capacity Number of elements held by a single segment of the channel
+/// @tparam T The type of values sent through the channel
+/// @tparam Wait The wait strategy used by the receiver when the channel is empty (default: BUSY_LOOP)
+/// @return A pair of sender and receiver for the channel
+/// The channel grows by linking new segments when the sender runs out of space. Segments drained by
+/// the receiver are handed back to the sender and reused, so after warming up no allocations are made
+/// and memory stays at the high-water mark.
+template <typename T, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
+std::pair<Sender<T, Wait>, Receiver<T, Wait>> channel(size_t segment_capacity = 1024) {
+    auto channel = std::make_shared<InnerChannel<T, Wait>>(segment_capacity);
+    return { Sender<T, Wait>(channel), Receiver<T, Wait>(channel) };
+}
+
+/// @brief Sender for an unbounded single-producer, single-consumer channel
+/// @tparam T The type of values sent through the channel
+/// @tparam Wait The wait strategy used by the channel
+/// It allows to send values to the channel. It is designed to be used only from one thread at a time.
+template <typename T, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
+class Sender {
+    /// Disallows sender creation outside of channel function
+    explicit Sender(std::shared_ptr<InnerChannel<T, Wait>> chan) : channel_(chan) {}
+public:
+    /// @brief Default constructor
+    /// @note required to have sender as class member
+    Sender() = default;
+    Sender(const Sender&) = delete;
+    Sender& operator=(const Sender&) = delete;
+
+    Sender& operator=(Sender&& other) noexcept {
+        channel_ = std::move(other.channel_);
+        return *this;
+    }
+    Sender(Sender&& other) noexcept : channel_(std::move(other.channel_)) {}
+
+    /// @brief Send a value to the channel (copy version)
+    /// @param value The value to send
+    /// @note This function never blocks, it may allocate a new segment if there is no free one
+    void send(const T& value) {
+        channel_->send(value);
+    }
+
+    /// @brief Send a value to the channel (move version)
+    /// @param value The value to send
+    /// @note This function never blocks, it may allocate a new segment if there is no free one
+    void send(T&& value) {
+        channel_->send(std::move(value));
+    }
+
+private:
+    std::shared_ptr<InnerChannel<T, Wait>> channel_;
+
+    friend std::pair<Sender<T, Wait>, Receiver<T, Wait>> channel<T, Wait>(size_t segment_capacity);
+};
+
+/// @brief Receiver for an unbounded single-producer, single-consumer channel
+/// @tparam T The type of values sent through the channel
+/// @tparam Wait The wait strategy used by the channel
+/// It allows to receive values from the channel. It is designed to be used only from one thread at a time.
+template <typename T, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
+class Receiver {
+    /// Disallows receiver creation outside of channel function
+    explicit Receiver(std::shared_ptr<InnerChannel<T, Wait>> chan) : channel_(chan) {}
+public:
+    /// @brief Default constructor
+    /// @note required to have receiver as class member
+    Receiver() = default;
+    Receiver(const Receiver&) = delete;
+    Receiver& operator=(const Receiver&) = delete;
+
+    Receiver& operator=(Receiver&& other) noexcept {
+        channel_ = std::move(other.channel_);
+        return *this;
+    }
+    Receiver(Receiver&& other) noexcept : channel_(std::move(other.channel_)) {}
+
+    /// @brief Try to receive a value from the channel
+    /// @param value The received value
+    /// @return ResponseStatus indicating the result of the operation
+    /// @note This function is lock-free.
+    ResponseStatus try_receive(T& value) noexcept(std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>) {
+        return channel_->try_receive(value);
+    }
+
+    /// @brief Receive a value from the channel
+    /// @return The received value
+    /// @note This function is lock-free but may block if the channel is empty.
+    T receive() noexcept(std::is_nothrow_default_constructible_v<T> && std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>) {
+        T value;
+        if (channel_->try_receive(value) != ResponseStatus::SUCCESS) [[ unlikely ]] {
+            do {
+                if constexpr (Wait == WaitStrategy::YIELD) {
+                    std::this_thread::yield(); // Yield to allow other threads to run
+                } else if constexpr (Wait == WaitStrategy::BUSY_LOOP) {
+                    asm volatile ("" ::: "memory"); // Busy loop, just spin with compiler barrier
+                } else if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
+                    channel_->sendCursor_.wait(channel_->sendCursorCache_, std::memory_order_acquire);
+                } else if constexpr (Wait == WaitStrategy::ADAPTIVE) {
+                    channel_->parker_.wait(channel_->sendCursor_, channel_->sendCursorCache_);
+                }
+            } while (channel_->try_receive(value) != ResponseStatus::SUCCESS);
+        }
+        return value;
+    }
+
+private:
+    std::shared_ptr<InnerChannel<T, Wait>> channel_;
+
+    friend std::pair<Sender<T, Wait>, Receiver<T, Wait>> channel<T, Wait>(size_t segment_capacity);
+};
+
+/// @brief Inner channel implementation for the unbounded SPSC queue
+/// @tparam T The type of values sent through the channel
+/// @tparam Wait The wait strategy used for internal operations
+/// This class is not intended to be used directly by users.
+/// Values are stored in a linked list of fixed-size segments. Cursors count all values ever sent and
+/// received, the sender publishes a value (and a newly linked segment) with a single release store.
+/// Drained segments are pushed by the receiver to `freeSegments_` and taken back by the sender, since
+/// only the sender pops from that list it is free from the ABA problem.
+/// @note this class is not thread safe and should be wrapped in std::shared_ptr
+template <typename T, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
+class InnerChannel {
+    static_assert(Wait != WaitStrategy::ASYNC, "ASYNC is supported only by spsc and oneshot channels");
+
+    struct Segment {
+        /// Next segment in the channel or in the free list
+        Segment* next;
+    };
+
+public:
+    /// @brief Construct a channel with a given segment capacity
+    /// @param segment_capacity Number of elements held by a single segment
+    explicit InnerChannel(size_t segment_capacity) :
+        segmentCapacity_(std::max<size_t>(segment_capacity, 1)) {
+
+        tail_ = allocate_segment();
+        head_ = tail_;
+    }
+
+    /// This should not be called if there is existing handle to reader or writer
+    ~InnerChannel() {
+        size_t sendCursor = sendCursor_.load(std::memory_order_seq_cst);
+
+        // Call destructors for all elements left in the channel
+        Segment* segment = head_;
+        size_t index = headIndex_;
+        for (size_t i = rcvCursor_; i != sendCursor; ++i) {
+            if (index == segmentCapacity_) {
+                segment = segment->next;
+                index = 0;
+            }
+            slot(segment, index++)->~T();
+        }
+
+        // Deallocate all segments in the channel, handed back by the receiver and cached by the sender
+        free_segments(head_, tail_);
+        free_segments(freeSegments_.load(std::memory_order_seq_cst), nullptr);
+        free_segments(cachedSegments_, nullptr);
+    }
+
+    /// @brief Send a value to the channel
+    /// @param value The value to send
+    /// @note It allocates only when there is no drained segment to reuse
+    template<typename U>
+    void send(U&& value) {
+        if (tailIndex_ == segmentCapacity_) [[ unlikely ]] {
+            Segment* segment = acquire_segment();
+            segment->next = nullptr;
+            // Published to the receiver together with the value by the cursor store below
+            tail_->next = segment;
+            tail_ = segment;
+            tailIndex_ = 0;
+        }
+
+        new (slot(tail_, tailIndex_)) T(std::forward<U>(value));
+        tailIndex_++;
+
+        sendCursor_.store(sendCursor_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+
+        if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
+            sendCursor_.notify_one(); // Notify receiver that a value has been sent
+        } else if constexpr (Wait == WaitStrategy::ADAPTIVE) {
+            parker_.notify_one();
+        }
+    }
+
+    /// @brief Try to receive a value from the channel
+    /// @param value The variable to store the received value
+    /// @return ResponseStatus indicating the result of the operation
+    /// @note This function is lock-free
+    ResponseStatus try_receive(T& value) noexcept(std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>) {
+        if (rcvCursor_ == sendCursorCache_) {
+            // Refresh cache
+            sendCursorCache_ = sendCursor_.load(std::memory_order_acquire);
+            if (rcvCursor_ == sendCursorCache_) {
+                return ResponseStatus::CHANNEL_EMPTY;
+            }
+        }
+
+        if (headIndex_ == segmentCapacity_) [[ unlikely ]] {
+            // Segment is drained, the sender linked the next one before publishing this value
+            Segment* drained = head_;
+            head_ = drained->next;
+            headIndex_ = 0;
+            recycle_segment(drained);
+        }
+
+        T* valuePtr = slot(head_, headIndex_);
+        value = std::move(*valuePtr);
+        valuePtr->~T(); // Call destructor
+        headIndex_++;
+        rcvCursor_++;
+
+        return ResponseStatus::SUCCESS;
+    }
+
+private:
+    /// @brief Get a segment for the sender, reusing drained segments when possible
+    inline Segment* acquire_segment() {
+        if (cachedSegments_ == nullptr) {
+            // Take all segments handed back by the receiver at once
+            cachedSegments_ = freeSegments_.exchange(nullptr, std::memory_order_acquire);
+            if (cachedSegments_ == nullptr) {
+                return allocate_segment();
+            }
+        }
+        Segment* segment = cachedSegments_;
+        cachedSegments_ = segment->next;
+        return segment;
+    }
+
+    /// @brief Hand a drained segment back to the sender
+    inline void recycle_segment(Segment* segment) noexcept {
+        Segment* top = freeSegments_.load(std::memory_order_relaxed);
+        do {
+            segment->next = top;
+        } while (!freeSegments_.compare_exchange_weak(top, segment, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    /// @brief Allocate a segment with raw storage for segmentCapacity_ elements
+    /// Uses raw memory allocation so the T type is not required to provide default constructors
+    inline Segment* allocate_segment() {
+        void* memory = ::operator new(segment_bytes(), std::align_val_t{segment_alignment});
+        return new (memory) Segment{ nullptr };
+    }
+
+    /// @brief Deallocate segments of a list, starting at first and ending at last (inclusive) or at the end of the list
+    inline void free_segments(Segment* first, Segment* last) noexcept {
+        while (first != nullptr) {
+            Segment* next = first == last ? nullptr : first->next;
+            first->~Segment();
+            ::operator delete(first, segment_bytes(), std::align_val_t{segment_alignment});
+            first = next;
+        }
+    }
+
+    /// @brief Get storage of the element at a given index of a segment
+    inline T* slot(Segment* segment, const size_t index) const noexcept {
+        return std::launder(reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(segment) + slots_offset)) + index;
+    }
+
+    inline size_t segment_bytes() const noexcept {
+        return slots_offset + segmentCapacity_ * sizeof(T);
+    }
+
+    /// Elements are stored right after the segment header
+    static constexpr size_t segment_alignment = std::max(alignof(Segment), alignof(T));
+    static constexpr size_t slots_offset = (sizeof(Segment) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+    const size_t segmentCapacity_;
+
+    /// Producer-side data (accessed by sender thread)
+    alignas(cache_line_size) std::atomic<size_t> sendCursor_{0};
+    alignas(cache_line_size) Segment* tail_;
+    size_t tailIndex_{0};
+    Segment* cachedSegments_{nullptr}; // segments taken from the free list and not used yet
+
+    /// Consumer-side data (accessed by receiver thread)
+    alignas(cache_line_size) size_t rcvCursor_{0};
+    size_t sendCursorCache_{0}; // reduces cache coherency
+    Segment* head_;
+    size_t headIndex_{0};
+
+    /// Drained segments handed back from the receiver to the sender
+    alignas(cache_line_size) std::atomic<Segment*> freeSegments_{nullptr};
+
+    /// Receiver parked by the ADAPTIVE strategy
+    [[no_unique_address]] __wait_parker<Wait> parker_;
+
+    friend class Sender<T, Wait>;
+    friend class Receiver<T, Wait>;
+};
+
+
+} // namespace channels::spsc::unbounded
@@ -0,0 +1,238 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * CPU Topology and Thread Pinning
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <pthread.h>
+#include <sched.h>
+
+#ifdef __linux__
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#endif
+
+/// Helpers to place the two sides of a channel on the machine: which logical CPUs share a physical core,
+/// a socket or a NUMA node, and pinning a thread to one of them.
+/// On Linux the topology is read from /sys/devices/system/cpu, elsewhere it is unknown.
+
+namespace channels::topology {
+
+/// @brief Position of one logical CPU in the machine
+struct cpu_info {
+    /// @brief Logical CPU id, the one passed to pin_thread
+    size_t cpu;
+
+    /// @brief Physical core id, unique only within a package, SMT siblings share it
+    long core;
+
+    /// @brief Physical package (socket) id
+    long package;
+
+    /// @brief NUMA node of the cpu, -1 if unknown
+    int node;
+};
+
+/// @brief How a cpu relates to another one, see find_cpu
+enum class CpuRelation {
+    /// @brief Another hardware thread of the same physical core
+    SMT_SIBLING,
+
+    /// @brief Another physical core of the same package
+    SAME_PACKAGE,
+
+    /// @brief A core of another package
+    OTHER_PACKAGE,
+
+    /// @brief A core of another NUMA node
+    OTHER_NODE
+};
+
+#ifdef __linux__
+
+namespace __detail {
+
+inline std::optional<long> read_topology(const size_t cpu, const char* name) {
+    std::ifstream file("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/" + name);
+    long value;
+    if (file >> value) {
+        return value;
+    }
+    return std::nullopt;
+}
+
+} // namespace __detail
+
+/// @brief Get the NUMA node of a cpu
+/// @return Node id, -1 if the kernel does not report nodes (e.g. built without NUMA support)
+inline int numa_node_of(const size_t cpu) {
+    // The cpu directory holds a nodeN link to its node
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator("/sys/devices/system/cpu/cpu" + std::to_string(cpu), error)) {
+        const std::string name = entry.path().filename().string();
+        if (name.size() > 4 && name.starts_with("node") && name.find_first_not_of("0123456789", 4) == std::string::npos) {
+            return std::atoi(name.c_str() + 4);
+        }
+    }
+    return -1;
+}
+
+/// @brief Get the topology of one cpu
+/// @return nullopt if the cpu is offline or the kernel does not report it
+inline std::optional<cpu_info> cpu_topology(const size_t cpu) {
+    const auto package = __detail::read_topology(cpu, "physical_package_id");
+    const auto core = __detail::read_topology(cpu, "core_id");
+    if (!package || !core) {
+        return std::nullopt;
+    }
+    return cpu_info{ cpu, *core, *package, numa_node_of(cpu) };
+}
+
+/// @brief Get the cpu the calling thread runs on right now
+/// @note The thread may be migrated right after, unless it is pinned
+inline std::optional<size_t> current_cpu() noexcept {
+    const int cpu = ::sched_getcpu();
+    if (cpu < 0) {
+        return std::nullopt;
+    }
+    return static_cast<size_t>(cpu);
+}
+
+/// @brief Pin a thread to one cpu
+/// @param cpu Logical cpu id
+/// @param thread Thread to pin, the calling one by default
+/// @return true if the thread is pinned
+inline bool pin_thread(const size_t cpu, const pthread_t thread = ::pthread_self()) noexcept {
+    if (cpu >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(cpu, &cpuset);
+    return ::pthread_setaffinity_np(thread, sizeof(cpu_set_t), &cpuset) == 0;
+}
+
+#else
+
+/// Without topology information nodes are unknown
+inline int numa_node_of(const size_t) {
+    return -1;
+}
+
+/// Without topology information no cpu is known
+inline std::optional<cpu_info> cpu_topology(const size_t) {
+    return std::nullopt;
+}
+
+inline std::optional<size_t> current_cpu() noexcept {
+    return std::nullopt;
+}
+
+/// @brief Threads can not be pinned here, the thread gets the highest priority it is allowed instead
+/// @return false, the thread is not pinned
+inline bool pin_thread(const size_t, const pthread_t thread = ::pthread_self()) noexcept {
+    struct sched_param param;
+    param.sched_priority = sched_get_priority_max(SCHED_FIFO);
+
+    // Real-time scheduling requires root privileges
+    if (::pthread_setschedparam(thread, SCHED_FIFO, &param) != 0) {
+        // Fallback: set thread priority within normal scheduling
+        param.sched_priority = sched_get_priority_max(SCHED_OTHER);
+        ::pthread_setschedparam(thread, SCHED_OTHER, &param);
+    }
+    return false;
+}
+
+#endif
+
+/// @brief Get the topology of every online cpu the kernel reports
+inline std::vector<cpu_info> cpus() {
+    std::vector<cpu_info> result;
+    const size_t count = std::thread::hardware_concurrency();
+    for (size_t cpu = 0; cpu < count; cpu++) {
+        if (const auto info = cpu_topology(cpu)) {
+            result.push_back(*info);
+        }
+    }
+    return result;
+}
+
+/// @brief Get the other hardware threads of the physical core of a cpu
+inline std::vector<size_t> smt_siblings(const size_t cpu) {
+    std::vector<size_t> result;
+    const auto self = cpu_topology(cpu);
+    if (!self) {
+        return result;
+    }
+    for (const cpu_info& other : cpus()) {
+        if (other.cpu != cpu && other.package == self->package && other.core == self->core) {
+            result.push_back(other.cpu);
+        }
+    }
+    return result;
+}
+
+/// @brief Get the cpus of a NUMA node
+inline std::vector<size_t> cpus_of_node(const int node) {
+    std::vector<size_t> result;
+    for (const cpu_info& info : cpus()) {
+        if (info.node == node) {
+            result.push_back(info.cpu);
+        }
+    }
+    return result;
+}
+
+/// @brief Find a cpu in the given relation to another one, e.g. where to put the consumer of a producer
+/// @param cpu The cpu to start from
+/// @param relation Where the result has to be relative to cpu
+/// @return The lowest such cpu, nullopt if the machine has none or its topology is unknown
+inline std::optional<size_t> find_cpu(const size_t cpu, const CpuRelation relation) {
+    const auto self = cpu_topology(cpu);
+    if (!self) {
+        return std::nullopt;
+    }
+    for (const cpu_info& other : cpus()) {
+        if (other.cpu == cpu) {
+            continue;
+        }
+        const bool same_package = other.package == self->package;
+        const bool same_core = same_package && other.core == self->core;
+        if ((relation == CpuRelation::SMT_SIBLING && same_core) ||
+            (relation == CpuRelation::SAME_PACKAGE && same_package && !same_core) ||
+            (relation == CpuRelation::OTHER_PACKAGE && !same_package) ||
+            (relation == CpuRelation::OTHER_NODE && self->node >= 0 && other.node >= 0 && other.node != self->node)) {
+            return other.cpu;
+        }
+    }
+    return std::nullopt;
+}
+
+} // namespace channels::topology
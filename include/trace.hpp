@@ -0,0 +1,124 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Trace Buffer Implementation
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <channels.hpp>
+
+/// In-process flight recorder for the trace events of CHANNELS_TRACE builds.
+/// It keeps the last N events of every channel in the process, so a stall seen in production can be
+/// matched with the queue depth around it without attaching a tracer.
+
+namespace channels {
+
+/// @brief Ring of the last N trace events
+/// @tparam N Number of events kept, a power of two
+/// Recording is wait-free and may happen from any number of threads at once: every event takes a ticket
+/// and claims its slot with its stamp. An event whose slot is still being written by a writer that was
+/// lapped is dropped and counted in dropped(). snapshot() never blocks the channels.
+template <size_t N = 4096>
+class trace_buffer {
+    static_assert(std::has_single_bit(N), "trace_buffer capacity has to be a power of two");
+public:
+    trace_buffer() noexcept = default;
+
+    trace_buffer(const trace_buffer&) = delete;
+    trace_buffer& operator=(const trace_buffer&) = delete;
+
+    /// @brief Removes the hook if it is still installed
+    ~trace_buffer() {
+        if (__trace::installed.context.load(std::memory_order_relaxed) == this) {
+            set_trace_hook(nullptr);
+        }
+    }
+
+    /// @brief Install this buffer as the trace hook of the process
+    void install() noexcept {
+        set_trace_hook(&record_hook, this);
+    }
+
+    /// @brief Record one event
+    void record(const trace_record& record) noexcept {
+        const uint64_t ticket = next_.fetch_add(1, std::memory_order_relaxed);
+        if (!slots_[ticket & (N - 1)].try_store(record, ticket)) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /// @brief Copy the recorded events, oldest first
+    /// @param out Output iterator receiving up to N trace_record
+    /// @return Number of events copied, events being written or overwritten meanwhile are left out
+    template <std::output_iterator<trace_record> It>
+    size_t snapshot(It out) const noexcept {
+        const uint64_t end = next_.load(std::memory_order_acquire);
+        const uint64_t begin = end > N ? end - N : 0;
+        size_t count = 0;
+        trace_record record;
+        for (uint64_t ticket = begin; ticket < end; ++ticket) {
+            if (slots_[ticket & (N - 1)].load(&record, ticket) == 2 * ticket + 2) {
+                *out = record;
+                ++out;
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    /// @brief Number of events recorded since the buffer was created, including the ones no longer kept
+    uint64_t recorded() const noexcept {
+        return next_.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Number of events lost to writers racing for one slot
+    uint64_t dropped() const noexcept {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    static void record_hook(const trace_record& record, void* context) noexcept {
+        static_cast<trace_buffer*>(context)->record(record);
+    }
+
+    alignas(cache_line_size) std::atomic<uint64_t> next_{ 0 };
+    alignas(cache_line_size) std::atomic<uint64_t> dropped_{ 0 };
+    alignas(cache_line_size) __sequenced_slot<trace_record> slots_[N];
+};
+
+/// @brief Name of a trace event, as used by the USDT probes
+constexpr const char* trace_event_name(const TraceEvent event) noexcept {
+    switch (event) {
+        case TraceEvent::SEND_BLOCKED: return "send_blocked";
+        case TraceEvent::SEND_RESUMED: return "send_resumed";
+        case TraceEvent::RECEIVE_BLOCKED: return "receive_blocked";
+        case TraceEvent::RECEIVE_RESUMED: return "receive_resumed";
+    }
+    return "";
+}
+
+}
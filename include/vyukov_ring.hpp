@@ -0,0 +1,267 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Bounded Sequence Ring Shared by the MPSC and MPMC Channels
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+#include <channels.hpp>
+
+namespace channels {
+
+/// @brief Bounded lock-free ring of sequenced slots behind the mpsc and mpmc channels
+/// @tparam T The type of values sent through the channel
+/// @tparam Strategy The overflow strategy to use when the channel is full
+/// @tparam Wait The wait strategy used for internal operations
+/// @tparam MultiConsumer Whether receivers compete for values, false for the mpsc channel
+/// This class is not intended to be used directly by users.
+/// Every slot carries a sequence number telling whose turn it is. Slot at position `pos` is free for the
+/// producer that claimed `pos` when its sequence equals `pos` and holds a value for the consumer that
+/// claims `pos` when its sequence equals `pos + 1`. Producers claim positions with a CAS on `enqueuePos_`,
+/// consumers too when there are several of them or senders may discard the oldest value.
+/// With several consumers slots are padded to the cache line so neighbouring producers and consumers never share one.
+/// @note this class should be wrapped in a reference counted pointer shared by the handles
+template <typename T, OverflowStrategy Strategy, WaitStrategy Wait, bool MultiConsumer>
+class __vyukov_ring {
+    static_assert(Wait != WaitStrategy::ASYNC, "ASYNC is supported only by spsc and oneshot channels");
+    static_assert(Strategy != OverflowStrategy::OVERWRITE_SEQUENCED, "OVERWRITE_SEQUENCED is supported only by spsc channels");
+
+    struct alignas(T) alignas(std::atomic<size_t>) alignas(MultiConsumer ? cache_line_size : 1) Slot {
+        std::atomic<size_t> sequence;
+        alignas(alignof(T)) unsigned char value[sizeof(T)];
+
+        inline T* get() noexcept {
+            return std::launder(reinterpret_cast<T*>(value));
+        }
+    };
+
+public:
+    /// @brief Construct a channel with a given capacity
+    /// @param capacity The minimum capacity of the channel, for performance it will be allocated with next power of 2
+    /// Uses raw memory allocation so the T type is not required to provide default constructors
+    explicit __vyukov_ring(size_t capacity) :
+        capacity_(next_power_of_2(capacity)),
+        capacity_mask_(capacity_ - 1),
+        buffer_(static_cast<Slot*>(operator new[](capacity_ * sizeof(Slot), std::align_val_t{alignof(Slot)}))) {
+
+        for (size_t i = 0; i < capacity_; ++i) {
+            new (&buffer_[i].sequence) std::atomic<size_t>(i);
+        }
+    }
+
+    __vyukov_ring(const __vyukov_ring&) = delete;
+    __vyukov_ring& operator=(const __vyukov_ring&) = delete;
+
+    /// This is called when the last sender or receiver handle is dropped
+    ~__vyukov_ring() {
+        // Call destructors for all elements in the buffer
+        size_t pos = dequeuePos_.load(std::memory_order_seq_cst);
+        while (buffer_[pos & capacity_mask_].sequence.load(std::memory_order_seq_cst) == pos + 1) {
+            buffer_[pos & capacity_mask_].get()->~T();
+            ++pos;
+        }
+
+        // Deallocate the buffer
+        ::operator delete[](
+            buffer_,
+            capacity_ * sizeof(Slot),
+            std::align_val_t{alignof(Slot)}
+        );
+    }
+
+    /// @brief Try to send a value to the channel
+    /// @param value The value to send
+    /// @return ResponseStatus indicating the result of the operation
+    /// @note This function is lock-free
+    template<typename U>
+    ResponseStatus try_send(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&> && std::is_nothrow_destructible_v<T>) {
+        size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        Slot* slot;
+
+        while (true) {
+            slot = &buffer_[pos & capacity_mask_];
+            const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+            if (diff == 0) {
+                // Slot is free, try to claim it
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                // Slot still holds the value from the previous lap so the channel is full
+                if constexpr (Strategy == OverflowStrategy::WAIT_ON_FULL) {
+                    return ResponseStatus::CHANNEL_FULL;
+                } else {
+                    // Drops the value only while it is the oldest one, a receiver that already claimed it is waited for
+                    discard_oldest(pos);
+                    pos = enqueuePos_.load(std::memory_order_relaxed);
+                }
+            } else {
+                // Other producer claimed this position
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        new (slot->value) T(std::forward<U>(value));
+        slot->sequence.store(pos + 1, std::memory_order_release);
+
+        if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
+            if constexpr (MultiConsumer) {
+                slot->sequence.notify_all(); // Notify receivers that a value has been sent
+            } else {
+                slot->sequence.notify_one(); // Notify receiver that a value has been sent
+            }
+        } else if constexpr (Wait == WaitStrategy::ADAPTIVE) {
+            if constexpr (MultiConsumer) {
+                parkers_.data.notify_all();
+            } else {
+                parkers_.data.notify_one();
+            }
+        }
+
+        return ResponseStatus::SUCCESS;
+    }
+
+    /// @brief Try to receive a value from the channel
+    /// @param value The variable to store the received value
+    /// @return ResponseStatus indicating the result of the operation
+    /// @note This function is lock-free, with a single consumer and WAIT_ON_FULL strategy also wait-free
+    ResponseStatus try_receive(T& value) noexcept(std::is_nothrow_move_assignable_v<T> && std::is_nothrow_destructible_v<T>) {
+        size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        Slot* slot;
+
+        while (true) {
+            slot = &buffer_[pos & capacity_mask_];
+            const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+
+            if (diff < 0) {
+                return ResponseStatus::CHANNEL_EMPTY;
+            }
+
+            if constexpr (!MultiConsumer && Strategy == OverflowStrategy::WAIT_ON_FULL) {
+                // Only receiver thread writes dequeuePos_ so the slot is ours
+                dequeuePos_.store(pos + 1, std::memory_order_relaxed);
+                break;
+            } else {
+                // Other receivers or senders discarding the oldest value compete for the position
+                if (diff == 0) {
+                    if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+                } else {
+                    pos = dequeuePos_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        value = std::move(*slot->get());
+        slot->get()->~T(); // Call destructor
+        slot->sequence.store(pos + capacity_, std::memory_order_release);
+
+        if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
+            slot->sequence.notify_all(); // Notify senders that a slot has been freed
+        } else if constexpr (Wait == WaitStrategy::ADAPTIVE) {
+            parkers_.space.notify_all();
+        }
+
+        return ResponseStatus::SUCCESS;
+    }
+
+    /// @brief Block until the slot next in line for senders is freed (ATOMIC_WAIT and ADAPTIVE strategies)
+    /// @note Called by the sender handles between failed sends
+    inline void wait_for_space() noexcept {
+        const size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        Slot& slot = buffer_[pos & capacity_mask_];
+        const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos) < 0) {
+            if constexpr (Wait == WaitStrategy::ADAPTIVE) {
+                parkers_.space.wait(slot.sequence, sequence);
+            } else {
+                slot.sequence.wait(sequence, std::memory_order_acquire);
+            }
+        }
+    }
+
+    /// @brief Block until the slot next in line for receivers is published (ATOMIC_WAIT and ADAPTIVE strategies)
+    /// @note Called by the receiver handles between failed receives
+    inline void wait_for_data() noexcept {
+        const size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        Slot& slot = buffer_[pos & capacity_mask_];
+        const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1) < 0) {
+            if constexpr (Wait == WaitStrategy::ADAPTIVE) {
+                parkers_.data.wait(slot.sequence, sequence);
+            } else {
+                slot.sequence.wait(sequence, std::memory_order_acquire);
+            }
+        }
+    }
+
+private:
+    /// @brief Drop the value occupying the slot of `pos` to make space for a new one (OVERWRITE_ON_FULL strategy)
+    /// @param pos The position the sender wants to claim
+    /// @note It behaves like a competing receiver that claims only `pos - capacity_`. If a receiver took that value
+    /// and has not freed the slot yet, dequeuePos_ is already past it and nothing happens, so the sender retries
+    /// until the slot is free instead of dropping the newer values behind it.
+    inline void discard_oldest(const size_t pos) noexcept(std::is_nothrow_destructible_v<T>) {
+        size_t oldest = pos - capacity_;
+        Slot* slot = &buffer_[pos & capacity_mask_];
+        const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+
+        if (sequence == oldest + 1 && dequeuePos_.compare_exchange_strong(oldest, oldest + 1, std::memory_order_relaxed)) {
+            slot->get()->~T();
+            slot->sequence.store(oldest + capacity_, std::memory_order_release);
+        }
+    }
+
+    /// @brief Calculate the next power of 2 greater than or equal to n
+    /// @param n The input value
+    /// @return The next power of 2, at least 2 because with a single slot its free and full sequences are equal
+    static constexpr size_t next_power_of_2(const size_t n) noexcept {
+        if (n <= 2) return 2;
+
+        // Use bit manipulation for efficiency
+        size_t power = 1;
+        while (power < n) {
+            power <<= 1;
+        }
+        return power;
+    }
+
+    const size_t capacity_;
+    const size_t capacity_mask_; // mask for bitwise index
+    Slot* buffer_;
+
+    /// Producers-side data (shared by all sender threads)
+    alignas(cache_line_size) std::atomic<size_t> enqueuePos_{0};
+
+    /// Consumers-side data (shared by all receiver threads, with a single consumer only the receiver and discarding senders)
+    alignas(cache_line_size) std::atomic<size_t> dequeuePos_{0};
+
+    /// Threads parked by the ADAPTIVE strategy
+    [[no_unique_address]] __wait_parkers<Wait> parkers_;
+};
+
+} // namespace channels
@@ -0,0 +1,358 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Watch Channel Implementation
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include <channels.hpp>
+#include <arc_ptr.hpp>
+
+namespace channels::watch {
+
+template<typename T, WaitStrategy Wait>
+class Sender;
+template<typename T, WaitStrategy Wait>
+class Receiver;
+template<typename T, WaitStrategy Wait>
+class InnerChannel;
+
+/// @brief Creates a watch channel holding the latest value published by the sender
+/// @tparam T The type of the value, it has to be copy constructible and assignable
+/// @tparam Wait The wait strategy used while the receiver waits for a change
+/// @param initial The value the receiver sees until the first send
+/// @return A pair of Sender and Receiver for the channel
+/// The channel is a triple buffer: the sender never blocks, the receiver always reads a complete value
+/// and older values are simply replaced. The three slots are allocated here, never later.
+template <typename T, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
+std::pair<Sender<T, Wait>, Receiver<T, Wait>> channel(const T& initial = T()) {
+    channels::arc_ptr<InnerChannel<T, Wait>> channel = channels::make_arc<InnerChannel<T, Wait>>(initial);
+    return {Sender<T, Wait>(channel), Receiver<T, Wait>(channel)};
+}
+
+/// @brief Sender for a watch channel
+/// @tparam T The type of the value
+/// @tparam Wait The wait strategy used by the channel
+/// It publishes new values, every send replaces the previous one. It is designed to be used only from one thread at a time.
+template<typename T, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
+class Sender {
+    explicit Sender(channels::arc_ptr<InnerChannel<T, Wait>> channel) noexcept : channel_(channel) {}
+public:
+    Sender() noexcept = default;
+    Sender(const Sender&) = delete;
+    Sender& operator=(const Sender&) = delete;
+
+    Sender(Sender&& other) noexcept : channel_(std::move(other.channel_)) {
+        other.channel_ = nullptr;
+    }
+
+    Sender& operator=(Sender&& other) noexcept {
+        if (this != &other) {
+            close();
+            channel_ = std::move(other.channel_);
+            other.channel_ = nullptr;
+        }
+        return *this;
+    }
+
+    /// @brief Destructor, closes the sender
+    ~Sender() {
+        close();
+    }
+
+    /// @brief Publishes a new value, replacing the previous one
+    /// @param value The value to publish
+    /// @return SUCCESS, or CHANNEL_CLOSED if the receiver was closed
+    /// @note This function never waits, a value the receiver did not look at is overwritten
+    ResponseStatus send(const T& value) noexcept(std::is_nothrow_copy_assignable_v<T>) {
+        return channel_.get_mut()->send(value);
+    }
+
+    /// @brief Publishes a new value, replacing the previous one
+    /// @param value The value to publish
+    /// @return SUCCESS, or CHANNEL_CLOSED if the receiver was closed
+    /// @note This function never waits, a value the receiver did not look at is overwritten
+    ResponseStatus send(T&& value) noexcept(std::is_nothrow_move_assignable_v<T>) {
+        return channel_.get_mut()->send(std::move(value));
+    }
+
+    /// @brief Close the sender and wake up the receiver
+    /// @note The receiver still gets the last value sent, then SENDER_CLOSED. The sender is empty afterwards.
+    void close() noexcept {
+        if (channel_) {
+            channel_.get_mut()->close_sender();
+            channel_ = nullptr;
+        }
+    }
+
+    /// @brief Check if the receiver was closed, values sent from now on are never seen
+    bool is_closed() const noexcept {
+        return !channel_ || channel_->receiver_closed();
+    }
+
+private:
+    channels::arc_ptr<InnerChannel<T, Wait>> channel_;
+
+    friend std::pair<Sender<T, Wait>, Receiver<T, Wait>> channel<T, Wait>(const T&);
+};
+
+/// @brief Receiver for a watch channel
+/// @tparam T The type of the value
+/// @tparam Wait The wait strategy used by the channel
+/// It reads the latest published value and waits for changes. It is designed to be used only from one thread at a time.
+template<typename T, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
+class Receiver {
+    explicit Receiver(channels::arc_ptr<InnerChannel<T, Wait>> channel) noexcept : channel_(channel) {}
+public:
+    Receiver() noexcept = default;
+    Receiver(const Receiver&) = delete;
+    Receiver& operator=(const Receiver&) = delete;
+
+    Receiver(Receiver&& other) noexcept : channel_(std::move(other.channel_)) {
+        other.channel_ = nullptr;
+    }
+
+    Receiver& operator=(Receiver&& other) noexcept {
+        if (this != &other) {
+            close();
+            channel_ = std::move(other.channel_);
+            other.channel_ = nullptr;
+        }
+        return *this;
+    }
+
+    /// @brief Destructor, closes the receiver
+    ~Receiver() {
+        close();
+    }
+
+    /// @brief Latest published value
+    /// @return Reference to the value, valid until the next call on this receiver
+    /// @note It marks the value as seen, so has_changed() returns false afterwards
+    const T& latest() noexcept {
+        return channel_.get_mut()->latest();
+    }
+
+    /// @brief Check if a value was published since the last one seen
+    bool has_changed() const noexcept {
+        return channel_->has_changed();
+    }
+
+    /// @brief Copies the latest value if it was not seen yet
+    /// @param value The variable to store the value
+    /// @return SUCCESS, CHANNEL_EMPTY if nothing changed, or SENDER_CLOSED if nothing changed and the sender was closed
+    ResponseStatus try_receive(T& value) noexcept(std::is_nothrow_copy_assignable_v<T>) {
+        InnerChannel<T, Wait>* channel = channel_.get_mut();
+        if (!channel->has_changed()) {
+            // Checked again after the flag, the last value may have been sent right before closing
+            return channel->sender_closed() && !channel->has_changed() ? ResponseStatus::SENDER_CLOSED : ResponseStatus::CHANNEL_EMPTY;
+        }
+        value = channel->latest();
+        return ResponseStatus::SUCCESS;
+    }
+
+    /// @brief Waits until a value not seen yet is published and copies it
+    /// @param value The variable to store the value
+    /// @return SUCCESS, or SENDER_CLOSED if the sender was closed and the last value was seen
+    ResponseStatus receive(T& value) noexcept(std::is_nothrow_copy_assignable_v<T>) {
+        ResponseStatus status;
+        while ((status = try_receive(value)) == ResponseStatus::CHANNEL_EMPTY) [[ unlikely ]] {
+            channel_.get_mut()->wait_for_change();
+        }
+        return status;
+    }
+
+    /// @brief Same as receive(value), waiting at most until deadline
+    /// @return SUCCESS, SENDER_CLOSED, or CHANNEL_EMPTY if the deadline has passed
+    /// @note The clock is read only while waiting, so the fast path costs the same as try_receive
+    template <typename Clock, typename Duration>
+    ResponseStatus receive_until(T& value, const std::chrono::time_point<Clock, Duration>& deadline) noexcept(std::is_nothrow_copy_assignable_v<T>) {
+        ResponseStatus status;
+        while ((status = try_receive(value)) == ResponseStatus::CHANNEL_EMPTY) {
+            if (!channel_.get_mut()->wait_for_change_until(deadline)) {
+                return status;
+            }
+        }
+        return status;
+    }
+
+    /// @brief Same as receive(value), waiting at most for timeout
+    /// @return SUCCESS, SENDER_CLOSED, or CHANNEL_EMPTY if the time has run out
+    template <typename Rep, typename Period>
+    ResponseStatus receive_for(T& value, const std::chrono::duration<Rep, Period>& timeout) noexcept(std::is_nothrow_copy_assignable_v<T>) {
+        return receive_until(value, std::chrono::steady_clock::now() + timeout);
+    }
+
+    /// @brief Close the receiver, the sender sees CHANNEL_CLOSED from now on
+    /// @note The receiver is empty afterwards
+    void close() noexcept {
+        if (channel_) {
+            channel_.get_mut()->close_receiver();
+            channel_ = nullptr;
+        }
+    }
+
+    /// @brief Check if the sender was closed, the last value sent can still be read
+    bool is_closed() const noexcept {
+        return !channel_ || channel_->sender_closed();
+    }
+
+private:
+    channels::arc_ptr<InnerChannel<T, Wait>> channel_;
+
+    friend std::pair<Sender<T, Wait>, Receiver<T, Wait>> channel<T, Wait>(const T&);
+};
+
+/// @brief Inner channel implementation for the watch channel
+/// @note This class is not intended to be used directly by users
+/// The sender owns the back slot and the receiver the front slot, the third one is parked in middle_.
+/// Publishing swaps the back slot into middle_ with the fresh bit set, reading a fresh value swaps it
+/// out for the front slot. Nobody ever touches a slot owned by the other side, so values cannot tear.
+template<typename T, WaitStrategy Wait = WaitStrategy::BUSY_LOOP>
+class InnerChannel {
+    static_assert(Wait != WaitStrategy::ASYNC, "ASYNC is supported only by spsc and oneshot channels");
+    static_assert(std::is_copy_constructible_v<T>, "watch values are copied into all three slots");
+public:
+    /// @brief Constructor for internal use only
+    /// @note This constructor is public to allow make_arc to work, but should not be called directly by users
+    explicit InnerChannel(const T& initial) : slots_{ {initial}, {initial}, {initial} } {}
+
+    template <typename U>
+    ResponseStatus send(U&& value) noexcept(std::is_nothrow_assignable_v<T&, U&&>) {
+        if (closed_.load(std::memory_order_relaxed) & receiver_closed_bit) [[ unlikely ]] {
+            return ResponseStatus::CHANNEL_CLOSED;
+        }
+        slots_[back_].value = std::forward<U>(value);
+        // release publishes the slot, acquire makes the receiver done with the slot we get back
+        back_ = middle_.exchange(back_ | fresh_bit, std::memory_order_acq_rel) & index_mask;
+        notify();
+        return ResponseStatus::SUCCESS;
+    }
+
+    bool has_changed() const noexcept {
+        return middle_.load(std::memory_order_acquire) & fresh_bit;
+    }
+
+    const T& latest() noexcept {
+        if (middle_.load(std::memory_order_relaxed) & fresh_bit) {
+            // release hands the front slot back, acquire makes the value in the fresh slot visible
+            front_ = middle_.exchange(front_, std::memory_order_acq_rel) & index_mask;
+        }
+        return slots_[front_].value;
+    }
+
+    /// @brief Block until something is published or the sender is closed
+    void wait_for_change() noexcept {
+        const uint32_t middle = middle_.load(std::memory_order_acquire);
+        if ((middle & fresh_bit) || sender_closed()) {
+            return;
+        }
+        if constexpr (Wait == WaitStrategy::YIELD) {
+            std::this_thread::yield();
+        } else if constexpr (Wait == WaitStrategy::BUSY_LOOP) {
+            asm volatile ("" ::: "memory");
+        } else if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
+            middle_.wait(middle, std::memory_order_acquire);
+        } else if constexpr (Wait == WaitStrategy::ADAPTIVE) {
+            parker_.wait(middle_, middle);
+        }
+    }
+
+    /// @brief Same as wait_for_change, giving up at deadline
+    /// @return false if the deadline has passed with nothing published
+    template <typename Clock, typename Duration>
+    bool wait_for_change_until(const std::chrono::time_point<Clock, Duration>& deadline) noexcept {
+        const uint32_t middle = middle_.load(std::memory_order_acquire);
+        if ((middle & fresh_bit) || sender_closed()) {
+            return true;
+        }
+        if constexpr (Wait == WaitStrategy::ADAPTIVE) {
+            return parker_.wait_until(middle_, middle, deadline);
+        } else {
+            return __wait_until<Wait>(middle_, middle, deadline);
+        }
+    }
+
+    /// @brief Mark the sender as closed and wake up the receiver
+    void close_sender() noexcept {
+        closed_.fetch_or(sender_closed_bit, std::memory_order_release);
+        // A waiting receiver sleeps on middle_, so closing has to change it too. The receiver may
+        // clear the bit again when it swaps slots, closed_ stays the source of truth.
+        middle_.fetch_or(wake_bit, std::memory_order_release);
+        notify();
+    }
+
+    /// @brief Mark the receiver as closed
+    void close_receiver() noexcept {
+        closed_.fetch_or(receiver_closed_bit, std::memory_order_release);
+    }
+
+    bool sender_closed() const noexcept {
+        return closed_.load(std::memory_order_acquire) & sender_closed_bit;
+    }
+
+    bool receiver_closed() const noexcept {
+        return closed_.load(std::memory_order_acquire) & receiver_closed_bit;
+    }
+
+private:
+    void notify() noexcept {
+        if constexpr (Wait == WaitStrategy::ATOMIC_WAIT) {
+            middle_.notify_one();
+        } else if constexpr (Wait == WaitStrategy::ADAPTIVE) {
+            parker_.notify_one();
+        }
+    }
+
+    /// @brief Slot padded to its own cache line, the sender writes one while the receiver reads another
+    struct alignas(cache_line_size) Slot {
+        T value;
+    };
+
+    static constexpr uint32_t index_mask = 3;
+    static constexpr uint32_t fresh_bit = 4;
+    static constexpr uint32_t wake_bit = 8;
+    static constexpr uint32_t sender_closed_bit = 1;
+    static constexpr uint32_t receiver_closed_bit = 2;
+
+    Slot slots_[3];
+
+    /// @brief Index of the slot owned by neither side, with fresh_bit set while it holds an unseen value
+    alignas(cache_line_size) std::atomic<uint32_t> middle_{ 1 };
+    std::atomic<uint32_t> closed_{ 0 };
+    [[no_unique_address]] __wait_parker<Wait> parker_;
+
+    /// @brief Slot the sender writes next, touched only by the sender
+    alignas(cache_line_size) uint32_t back_ = 2;
+
+    /// @brief Slot the receiver reads, touched only by the receiver
+    alignas(cache_line_size) uint32_t front_ = 0;
+};
+
+} // namespace channels::watch
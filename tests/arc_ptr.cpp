@@ -0,0 +1,184 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Arc Pointer Stress Tests
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <arc_ptr.hpp>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include "tools/check.hpp"
+
+using namespace channels;
+
+constexpr size_t THREADS = 4;
+constexpr size_t ROUNDS = 200;
+constexpr size_t OPERATIONS = 2000;
+constexpr uint64_t ALIVE = 0x5eed5eed5eed5eedull;
+
+/// @brief Payload that counts its destructions and poisons itself, a use after destruction reads a wrong marker
+struct counted {
+    static inline std::atomic<int64_t> destroyed{0};
+
+    uint64_t marker = ALIVE;
+
+    ~counted() {
+        marker = 0;
+        destroyed.fetch_add(1, std::memory_order_relaxed);
+    }
+};
+
+/// @brief Number of blocks handed out by counting_allocator and not yet taken back, shared by all rebinds
+inline std::atomic<int64_t> blocks_outstanding{0};
+
+/// @brief Allocator counting the blocks it has handed out
+template <typename T>
+struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() noexcept = default;
+    template <typename U>
+    counting_allocator(const counting_allocator<U>&) noexcept {}
+
+    T* allocate(size_t n) {
+        blocks_outstanding.fetch_add(1, std::memory_order_relaxed);
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* ptr, size_t n) noexcept {
+        blocks_outstanding.fetch_sub(1, std::memory_order_relaxed);
+        std::allocator<T>().deallocate(ptr, n);
+    }
+
+    template <typename U>
+    bool operator==(const counting_allocator<U>&) const noexcept { return true; }
+};
+
+inline arc_ptr<counted> make_counted(test::jitter& jitter) {
+    if (jitter.below(2) == 0) {
+        return make_arc<counted>();
+    }
+    return allocate_arc<counted>(counting_allocator<counted>());
+}
+
+/// @brief Copies of one arc_ptr are made, moved and dropped on every thread at once, the payload is destroyed exactly once
+void shared_stress() {
+    test::jitter jitter(0);
+    for (size_t round = 0; round < ROUNDS * test::scale(); ++round) {
+        const int64_t before = counted::destroyed.load();
+        arc_ptr<counted> shared = make_counted(jitter);
+
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < THREADS; ++t) {
+            threads.emplace_back([round, t, copy = shared]() mutable {
+                test::jitter jitter(round * THREADS + t + 1);
+                std::vector<arc_ptr<counted>> local(8, copy);
+                copy = nullptr;
+                for (size_t i = 0; i < OPERATIONS; ++i) {
+                    arc_ptr<counted>& a = local[jitter.below(local.size())];
+                    arc_ptr<counted>& b = local[jitter.below(local.size())];
+                    switch (jitter.below(4)) {
+                        case 0: a = b; break;
+                        case 1: a = std::move(b); break;
+                        case 2: { arc_ptr<counted> held(b); CHECK(!held || held->marker == ALIVE); break; }
+                        default: a = nullptr; break;
+                    }
+                    CHECK(!a || a->marker == ALIVE);
+                    jitter();
+                }
+            });
+        }
+
+        // Dropping the original before the threads finish leaves only their copies
+        if (jitter.below(2) == 0) {
+            shared = nullptr;
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        if (shared) {
+            CHECK(shared.use_count() == 1);
+            CHECK(shared->marker == ALIVE);
+            shared = nullptr;
+        }
+        CHECK(counted::destroyed.load() - before == 1);
+    }
+    CHECK(blocks_outstanding.load() == 0);
+}
+
+/// @brief weak_arc::lock races with the last strong references being dropped
+/// A lock either gets a live payload or fails, once it failed it never succeeds again.
+void weak_stress() {
+    test::jitter jitter(1);
+    for (size_t round = 0; round < ROUNDS * test::scale(); ++round) {
+        const int64_t before = counted::destroyed.load();
+        arc_ptr<counted> strong = make_counted(jitter);
+        weak_arc<counted> weak(strong);
+
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < THREADS; ++t) {
+            const bool owner = t % 2 == 0;
+            threads.emplace_back([round, t, owner, copy = owner ? strong : arc_ptr<counted>(), weak]() mutable {
+                test::jitter jitter(round * THREADS + t + 1);
+                if (owner) {
+                    for (size_t i = 0, n = jitter.below(OPERATIONS); i < n; ++i) {
+                        CHECK(copy->marker == ALIVE);
+                        jitter();
+                    }
+                    copy = nullptr;
+                    return;
+                }
+                bool expired = false;
+                for (size_t i = 0; i < OPERATIONS; ++i) {
+                    arc_ptr<counted> locked = weak.lock();
+                    CHECK(!(expired && locked));
+                    if (locked) {
+                        CHECK(locked->marker == ALIVE);
+                        CHECK(locked.use_count() >= 1);
+                    } else {
+                        expired = true;
+                        CHECK(weak.expired());
+                    }
+                    jitter();
+                }
+            });
+        }
+
+        strong = nullptr;
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        CHECK(weak.expired());
+        CHECK(!weak.lock());
+        CHECK(counted::destroyed.load() - before == 1);
+    }
+    CHECK(blocks_outstanding.load() == 0);
+}
+
+int main() {
+    test::run("shared copies", shared_stress);
+    test::run("weak lock", weak_stress);
+    return test::finish();
+}
@@ -0,0 +1,116 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Broadcast Stress Tests
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <broadcast.hpp>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include "tools/check.hpp"
+
+using namespace channels;
+
+constexpr uint64_t MESSAGES = 20000;
+constexpr size_t ROUNDS = 4;
+
+/// @brief Every receiver gets every value in order, then SENDER_CLOSED once the sender closed and the ring is drained
+/// A receive() after that returns a value-initialized T.
+template <WaitStrategy Wait>
+void fan_out_stress() {
+    for (size_t round = 0; round < ROUNDS * test::scale(); ++round) {
+        test::jitter jitter(round);
+        auto [sender, receivers] = broadcast::channel<uint64_t, OverflowStrategy::WAIT_ON_FULL, Wait>(size_t{1} << (1 + jitter.below(6)), 1 + jitter.below(4));
+
+        std::vector<std::thread> consumers;
+        for (size_t id = 0; id < receivers.size(); ++id) {
+            consumers.emplace_back([&, round, id, receiver = std::move(receivers[id])]() mutable {
+                test::jitter jitter(round * 16 + id + 1);
+                uint64_t expected = 0;
+                uint64_t value = 0;
+                while (receiver.receive(value) == ResponseStatus::SUCCESS) {
+                    CHECK(value == expected);
+                    ++expected;
+                    jitter();
+                }
+                CHECK(expected == MESSAGES);
+                CHECK(receiver.try_receive(value) == ResponseStatus::SENDER_CLOSED);
+                CHECK(receiver.receive(value) == ResponseStatus::SENDER_CLOSED);
+                CHECK(receiver.receive() == 0);
+            });
+        }
+
+        for (uint64_t i = 0; i < MESSAGES; ++i) {
+            CHECK(sender.send(i) == ResponseStatus::SUCCESS);
+            jitter();
+        }
+        sender.close();
+        for (auto& consumer : consumers) {
+            consumer.join();
+        }
+    }
+}
+
+/// @brief A lapped receiver skips ahead, values stay in order and the last one sent is never lost
+template <OverflowStrategy Strategy>
+void overwrite_stress() {
+    for (size_t round = 0; round < ROUNDS * test::scale(); ++round) {
+        test::jitter jitter(round);
+        auto [sender, receivers] = broadcast::channel<uint64_t, Strategy, WaitStrategy::YIELD>(size_t{1} << (1 + jitter.below(6)), 1 + jitter.below(4));
+
+        std::vector<std::thread> consumers;
+        for (size_t id = 0; id < receivers.size(); ++id) {
+            consumers.emplace_back([&, round, id, receiver = std::move(receivers[id])]() mutable {
+                test::jitter jitter(round * 16 + id + 1);
+                uint64_t next = 0;
+                uint64_t value = 0;
+                while (receiver.receive(value) == ResponseStatus::SUCCESS) {
+                    CHECK(value >= next && value < MESSAGES);
+                    next = value + 1;
+                    jitter();
+                }
+                CHECK(next == MESSAGES);
+                CHECK(receiver.receive(value) == ResponseStatus::SENDER_CLOSED);
+            });
+        }
+
+        for (uint64_t i = 0; i < MESSAGES; ++i) {
+            CHECK(sender.send(i) == ResponseStatus::SUCCESS);
+            jitter();
+        }
+        sender.close();
+        for (auto& consumer : consumers) {
+            consumer.join();
+        }
+    }
+}
+
+int main() {
+    test::run("fan out YIELD", fan_out_stress<WaitStrategy::YIELD>);
+    test::run("fan out ATOMIC_WAIT", fan_out_stress<WaitStrategy::ATOMIC_WAIT>);
+    test::run("fan out ADAPTIVE", fan_out_stress<WaitStrategy::ADAPTIVE>);
+    test::run("overwrite", overwrite_stress<OverflowStrategy::OVERWRITE_ON_FULL>);
+    test::run("overwrite sequenced", overwrite_stress<OverflowStrategy::OVERWRITE_SEQUENCED>);
+    return test::finish();
+}
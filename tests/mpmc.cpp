@@ -0,0 +1,165 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * MPSC and MPMC Stress Tests
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <mpsc.hpp>
+#include <mpmc.hpp>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include "tools/check.hpp"
+
+using namespace channels;
+
+constexpr uint64_t MESSAGES = 20000;
+constexpr size_t PRODUCERS = 3;
+constexpr size_t ROUNDS = 4;
+
+/// @brief Value counting its live instances, every constructed tracked has to be destroyed exactly once
+struct tracked {
+    static inline std::atomic<int64_t> live{0};
+
+    uint64_t value = 0;
+
+    tracked() noexcept { live.fetch_add(1, std::memory_order_relaxed); }
+    tracked(uint64_t v) noexcept : value(v) { live.fetch_add(1, std::memory_order_relaxed); }
+    tracked(const tracked& other) noexcept : value(other.value) { live.fetch_add(1, std::memory_order_relaxed); }
+    tracked(tracked&& other) noexcept : value(other.value) { live.fetch_add(1, std::memory_order_relaxed); }
+    tracked& operator=(const tracked&) noexcept = default;
+    tracked& operator=(tracked&&) noexcept = default;
+    ~tracked() { live.fetch_sub(1, std::memory_order_relaxed); }
+};
+
+/// @brief The mpsc channel, a single receiver
+struct mpsc_kind {
+    static constexpr size_t consumers = 1;
+
+    template <typename T, OverflowStrategy Strategy, WaitStrategy Wait>
+    static auto make(size_t capacity) {
+        return mpsc::channel<T, Strategy, Wait>(capacity);
+    }
+};
+
+/// @brief The mpmc channel, receivers copied for two consumer threads
+struct mpmc_kind {
+    static constexpr size_t consumers = 2;
+
+    template <typename T, OverflowStrategy Strategy, WaitStrategy Wait>
+    static auto make(size_t capacity) {
+        return mpmc::channel<T, Strategy, Wait>(capacity);
+    }
+};
+
+/// @brief Producers race each other and the consumers, every value is received at most once and
+/// in the order its producer sent it. Without overwriting every value is received exactly once.
+template <typename Kind, OverflowStrategy Strategy, WaitStrategy Wait>
+void exchange_round(size_t round) {
+    test::jitter jitter(round);
+    auto [sender, receiver] = Kind::template make<tracked, Strategy, Wait>(size_t{1} << (1 + jitter.below(5)));
+    std::vector<std::atomic<uint8_t>> seen(PRODUCERS * MESSAGES);
+    std::atomic<uint64_t> received{0};
+    std::atomic<bool> sent{false};
+
+    auto consume = [&](auto receiver, size_t id) {
+        test::jitter jitter(round * 16 + id);
+        std::vector<uint64_t> next(PRODUCERS, 0);
+        tracked value;
+        while (true) {
+            if (receiver.try_receive(value) == ResponseStatus::SUCCESS) {
+                const uint64_t producer = value.value / MESSAGES;
+                const uint64_t sequence = value.value % MESSAGES;
+                CHECK(producer < PRODUCERS && sequence >= next[producer]);
+                next[producer] = sequence + 1;
+                seen[value.value].fetch_add(1, std::memory_order_relaxed);
+                if constexpr (Strategy == OverflowStrategy::WAIT_ON_FULL) {
+                    if (received.fetch_add(1, std::memory_order_relaxed) + 1 == PRODUCERS * MESSAGES) break;
+                }
+            } else if constexpr (Strategy == OverflowStrategy::WAIT_ON_FULL) {
+                if (received.load(std::memory_order_relaxed) == PRODUCERS * MESSAGES) break;
+            } else if (sent.load(std::memory_order_acquire)) {
+                // The producers are done and the channel is drained
+                if (receiver.try_receive(value) != ResponseStatus::SUCCESS) break;
+                seen[value.value].fetch_add(1, std::memory_order_relaxed);
+            }
+            jitter();
+        }
+    };
+
+    std::vector<std::thread> consumers;
+    if constexpr (Kind::consumers > 1) {
+        for (size_t id = 0; id < Kind::consumers; ++id) {
+            consumers.emplace_back(consume, receiver, id);
+        }
+    } else {
+        consumers.emplace_back(consume, std::move(receiver), 0);
+    }
+
+    std::vector<std::thread> producers;
+    for (size_t producer = 0; producer < PRODUCERS; ++producer) {
+        producers.emplace_back([&, producer, sender = sender]() mutable {
+            test::jitter jitter(round * 16 + 8 + producer);
+            for (uint64_t i = 0; i < MESSAGES; ++i) {
+                sender.send(tracked(producer * MESSAGES + i));
+                jitter();
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    sent.store(true, std::memory_order_release);
+    for (auto& consumer : consumers) {
+        consumer.join();
+    }
+
+    for (auto& count : seen) {
+        if constexpr (Strategy == OverflowStrategy::WAIT_ON_FULL) {
+            CHECK(count.load() == 1);
+        } else {
+            CHECK(count.load() <= 1);
+        }
+    }
+}
+
+/// @brief Runs rounds with random capacities, every value left in the channel is destroyed with it
+template <typename Kind, OverflowStrategy Strategy, WaitStrategy Wait>
+void exchange_stress() {
+    for (size_t round = 0; round < ROUNDS * test::scale(); ++round) {
+        exchange_round<Kind, Strategy, Wait>(round);
+        CHECK(tracked::live.load() == 0);
+    }
+}
+
+int main() {
+    test::run("mpsc YIELD", exchange_stress<mpsc_kind, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::YIELD>);
+    test::run("mpsc ATOMIC_WAIT", exchange_stress<mpsc_kind, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::ATOMIC_WAIT>);
+    test::run("mpsc ADAPTIVE", exchange_stress<mpsc_kind, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::ADAPTIVE>);
+    test::run("mpsc overwrite YIELD", exchange_stress<mpsc_kind, OverflowStrategy::OVERWRITE_ON_FULL, WaitStrategy::YIELD>);
+    test::run("mpmc YIELD", exchange_stress<mpmc_kind, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::YIELD>);
+    test::run("mpmc ATOMIC_WAIT", exchange_stress<mpmc_kind, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::ATOMIC_WAIT>);
+    test::run("mpmc ADAPTIVE", exchange_stress<mpmc_kind, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::ADAPTIVE>);
+    test::run("mpmc overwrite YIELD", exchange_stress<mpmc_kind, OverflowStrategy::OVERWRITE_ON_FULL, WaitStrategy::YIELD>);
+    return test::finish();
+}
@@ -0,0 +1,229 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Oneshot Channel Stress Tests
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <oneshot.hpp>
+#include <spsc.hpp>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include "tools/check.hpp"
+
+using namespace channels;
+
+constexpr size_t EXCHANGES = 2000;
+
+/// @brief Value counting its live instances, every constructed tracked has to be destroyed exactly once
+struct tracked {
+    static inline std::atomic<int64_t> live{0};
+
+    uint64_t value = 0;
+
+    tracked() noexcept { live.fetch_add(1, std::memory_order_relaxed); }
+    tracked(uint64_t v) noexcept : value(v) { live.fetch_add(1, std::memory_order_relaxed); }
+    tracked(const tracked& other) noexcept : value(other.value) { live.fetch_add(1, std::memory_order_relaxed); }
+    tracked(tracked&& other) noexcept : value(other.value) { live.fetch_add(1, std::memory_order_relaxed); }
+    tracked& operator=(const tracked&) noexcept = default;
+    tracked& operator=(tracked&&) noexcept = default;
+    ~tracked() { live.fetch_sub(1, std::memory_order_relaxed); }
+};
+
+/// @brief The value sent on another thread is received exactly once, a second receive reports the receiver closed
+template <WaitStrategy Wait>
+void exchange_stress() {
+    test::jitter jitter(0);
+    for (size_t i = 0; i < EXCHANGES * test::scale(); ++i) {
+        auto [sender, receiver] = oneshot::channel<tracked, Wait>();
+        std::thread producer([&, i, sender = std::move(sender)]() mutable {
+            CHECK(sender.send(tracked(i)) == ResponseStatus::SUCCESS);
+            CHECK(sender.send(tracked(i)) == ResponseStatus::SENDER_CLOSED);
+        });
+
+        tracked value;
+        if (jitter.below(2) == 0) {
+            value = receiver.receive();
+        } else {
+            ResponseStatus status;
+            while ((status = receiver.try_receive(value)) == ResponseStatus::CHANNEL_EMPTY) {
+                std::this_thread::yield();
+            }
+            CHECK(status == ResponseStatus::SUCCESS);
+        }
+        CHECK(value.value == i);
+        CHECK(receiver.try_receive(value) == ResponseStatus::RECEIVER_CLOSED);
+        producer.join();
+    }
+    CHECK(tracked::live.load() == 0);
+}
+
+/// @brief Both handles are dropped on different threads, with or without a value left in the channel
+template <WaitStrategy Wait>
+void drop_stress() {
+    test::jitter jitter(1);
+    for (size_t i = 0; i < EXCHANGES * test::scale(); ++i) {
+        auto [sender, receiver] = oneshot::channel<tracked, Wait>();
+        const bool send = jitter.below(2) == 0;
+        std::thread producer([&, sender = std::move(sender)]() mutable {
+            if (send) {
+                CHECK(sender.send(tracked(i)) == ResponseStatus::SUCCESS);
+            }
+            oneshot::Sender<tracked, Wait> dropped = std::move(sender);
+        });
+        oneshot::Receiver<tracked, Wait> dropped = std::move(receiver);
+        producer.join();
+    }
+    CHECK(tracked::live.load() == 0);
+}
+
+/// @brief One channel serves every round trip, stale senders keep racing with reset and are always rejected
+template <WaitStrategy Wait>
+void reset_round_trips() {
+    using sender_type = oneshot::Sender<tracked, Wait>;
+    auto [requests, responder_requests] = spsc::channel<sender_type, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::YIELD>(4);
+    auto [sender, receiver] = oneshot::channel<tracked, Wait>();
+
+    std::thread responder([&, responder_requests = std::move(responder_requests)]() mutable {
+        sender_type current;
+        sender_type stale;
+        uint64_t round = 0;
+        while (responder_requests.receive(current) == ResponseStatus::SUCCESS) {
+            CHECK(current.send(tracked(round)) == ResponseStatus::SUCCESS);
+            // The receiver may reset the channel at any moment now, the old generation never gets through
+            CHECK(current.send(tracked(round)) == ResponseStatus::SENDER_CLOSED);
+            if (round > 0) {
+                CHECK(stale.send(tracked(round)) == ResponseStatus::SENDER_CLOSED);
+            }
+            stale = std::move(current);
+            ++round;
+        }
+    });
+
+    CHECK(requests.send(std::move(sender)) == ResponseStatus::SUCCESS);
+    for (uint64_t round = 0; round < EXCHANGES * test::scale(); ++round) {
+        CHECK(receiver.receive().value == round);
+        CHECK(requests.send(receiver.reset()) == ResponseStatus::SUCCESS);
+    }
+    // The responder still answers the last request
+    requests.close();
+    responder.join();
+}
+
+/// @brief The value still in the channel after the last round trip is destroyed together with the channel
+template <WaitStrategy Wait>
+void reset_stress() {
+    reset_round_trips<Wait>();
+    CHECK(tracked::live.load() == 0);
+}
+
+/// @brief The receiver gives up on every exchange at a random moment and resets while the sender may be writing its value
+/// A value sent too late is destroyed by the reset, a receive only ever sees the value of its own round
+template <WaitStrategy Wait>
+void abandon_round_trips() {
+    using sender_type = oneshot::Sender<tracked, Wait>;
+    auto [requests, responder_requests] = spsc::channel<sender_type, OverflowStrategy::WAIT_ON_FULL, WaitStrategy::YIELD>(4);
+    auto [sender, receiver] = oneshot::channel<tracked, Wait>();
+
+    std::thread responder([&, responder_requests = std::move(responder_requests)]() mutable {
+        test::jitter jitter(1);
+        sender_type current;
+        uint64_t round = 0;
+        while (responder_requests.receive(current) == ResponseStatus::SUCCESS) {
+            jitter();
+            const ResponseStatus status = current.send(tracked(round));
+            CHECK(status == ResponseStatus::SUCCESS || status == ResponseStatus::SENDER_CLOSED);
+            ++round;
+        }
+    });
+
+    test::jitter jitter(2);
+    CHECK(requests.send(std::move(sender)) == ResponseStatus::SUCCESS);
+    for (uint64_t round = 0; round < EXCHANGES * test::scale(); ++round) {
+        jitter();
+        tracked value;
+        if (receiver.try_receive(value) == ResponseStatus::SUCCESS) {
+            CHECK(value.value == round);
+        }
+        CHECK(requests.send(receiver.reset()) == ResponseStatus::SUCCESS);
+    }
+    requests.close();
+    responder.join();
+}
+
+/// @brief Abandoned exchanges neither leak nor destroy a value twice
+template <WaitStrategy Wait>
+void abandon_stress() {
+    abandon_round_trips<Wait>();
+    CHECK(tracked::live.load() == 0);
+}
+
+/// @brief Channel handle released by a thread_local destructor that runs after the pool's thread cache is gone
+struct late_holder {
+    oneshot::Receiver<tracked, WaitStrategy::YIELD> receiver;
+
+    ~late_holder() {
+        oneshot::Receiver<tracked, WaitStrategy::YIELD> dropped = std::move(receiver);
+        auto [sender, fresh] = oneshot::channel<tracked, WaitStrategy::YIELD>();
+        CHECK(sender.send(tracked(1)) == ResponseStatus::SUCCESS);
+    }
+};
+
+/// @brief Payloads released and allocated while the thread exits go through the shared list of the pool
+void late_release() {
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 8; ++i) {
+        threads.emplace_back([]() {
+            // Constructed before the pool's thread cache, so it is destroyed after it
+            static thread_local late_holder holder;
+            auto [sender, receiver] = oneshot::channel<tracked, WaitStrategy::YIELD>();
+            CHECK(sender.send(tracked(0)) == ResponseStatus::SUCCESS);
+            holder.receiver = std::move(receiver);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    // The blocks left by the exited threads are reused from the shared list
+    for (size_t i = 0; i < 2 * arc_pool<oneshot::InnerChannel<tracked, WaitStrategy::YIELD>>::slab_blocks; ++i) {
+        auto [sender, receiver] = oneshot::channel<tracked, WaitStrategy::YIELD>();
+        CHECK(sender.send(tracked(i)) == ResponseStatus::SUCCESS);
+        CHECK(receiver.receive().value == i);
+    }
+    CHECK(tracked::live.load() == 0);
+}
+
+int main() {
+    test::run("exchange YIELD", exchange_stress<WaitStrategy::YIELD>);
+    test::run("exchange ATOMIC_WAIT", exchange_stress<WaitStrategy::ATOMIC_WAIT>);
+    test::run("exchange ADAPTIVE", exchange_stress<WaitStrategy::ADAPTIVE>);
+    test::run("drop YIELD", drop_stress<WaitStrategy::YIELD>);
+    test::run("drop ADAPTIVE", drop_stress<WaitStrategy::ADAPTIVE>);
+    test::run("reset YIELD", reset_stress<WaitStrategy::YIELD>);
+    test::run("reset ATOMIC_WAIT", reset_stress<WaitStrategy::ATOMIC_WAIT>);
+    test::run("reset ADAPTIVE", reset_stress<WaitStrategy::ADAPTIVE>);
+    test::run("abandon YIELD", abandon_stress<WaitStrategy::YIELD>);
+    test::run("abandon ADAPTIVE", abandon_stress<WaitStrategy::ADAPTIVE>);
+    test::run("late release", late_release);
+    return test::finish();
+}
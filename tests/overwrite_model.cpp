@@ -0,0 +1,448 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * OVERWRITE_ON_FULL Interleaving Model Check
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Exhaustive check of the oldestOccupied_ protocol of spsc OVERWRITE_ON_FULL channels.
+ *
+ * try_send_overwrite_on_full, try_receive, try_receive_n and close_receiver are modeled as state machines,
+ * one step per shared access. Accesses to a slot take two steps, the slot is marked as in use between them,
+ * so a send or a receive touching a slot the other thread is in the middle of is caught as well.
+ * Every interleaving of a sender script and a receiver script is explored, states already visited are
+ * pruned. The model runs under sequential consistency, memory orders are covered by the stress tests
+ * built with ThreadSanitizer. It has to be kept in sync with spsc.hpp by hand.
+ */
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <unordered_set>
+#include <iostream>
+#include "tools/check.hpp"
+
+constexpr uint8_t MAX_CAPACITY = 8;
+constexpr uint8_t CLOSED = 0x80;
+constexpr uint8_t NONE = 0xff;
+
+enum class Op : uint8_t { SEND, CLOSE_SENDER, RECEIVE, RECEIVE_N, CLOSE_RECEIVER };
+
+/// @brief Maximum run taken by a modeled try_receive_n
+constexpr uint8_t RECEIVE_N_MAX = 2;
+
+/// @brief Program counters, each names the shared access done by the next step
+enum Pc : uint8_t {
+    OP_BEGIN,
+    // try_send_overwrite_on_full
+    S_LOAD_RCV, S_EXCHANGE, S_LOAD_NEWEST, S_RELEASE_CLOSED, S_DROP_BEGIN, S_DROP_END, S_STORE_RCV, S_RELEASE,
+    S_WRITE_BEGIN, S_WRITE_END, S_PUBLISH,
+    // try_receive and try_receive_n
+    R_EXCHANGE, R_LOAD_RCV, R_LOAD_SEND, R_READ_BEGIN, R_READ_END, R_ADVANCE, R_RELEASE,
+    // close_receiver
+    C_EXCHANGE, C_CLOSE, C_RELEASE
+};
+
+/// @brief Shared memory of the channel and local state of both threads
+/// Only uint8_t members, so the bytes of a state are its identity in the visited set.
+struct state {
+    uint8_t sendCursor = 0;
+    uint8_t rcvCursor = 0;
+    uint8_t oldestOccupied = 0;
+    uint8_t live[MAX_CAPACITY] = {};
+    uint8_t value[MAX_CAPACITY] = {};
+    uint8_t writing = NONE;         // slot the sender is constructing or destroying
+    uint8_t readingFirst = NONE;    // run of slots the receiver is moving out
+    uint8_t readingCount = 0;
+
+    // Sender
+    uint8_t s_op = 0;
+    uint8_t s_pc = OP_BEGIN;
+    uint8_t s_send = 0;
+    uint8_t s_next = 0;
+    uint8_t s_rcvCache = 0;
+    uint8_t s_newest = 0;
+    uint8_t s_sent = 0;             // successful sends, values are 1, 2, ...
+    uint8_t overwritten = 0;
+
+    // Receiver
+    uint8_t r_op = 0;
+    uint8_t r_pc = OP_BEGIN;
+    uint8_t r_rcv = 0;
+    uint8_t r_sendCache = 0;
+    uint8_t r_position = 0;         // rcvCursor_ as the receiver last stored it
+    uint8_t r_count = 0;
+    uint8_t r_last = 0;             // last received value, 0 before the first one
+    uint8_t r_received = 0;
+    uint8_t r_closed = 0;
+};
+
+struct scenario {
+    uint8_t capacity;
+    std::vector<Op> sender;
+    std::vector<Op> receiver;
+};
+
+class model_checker {
+public:
+    explicit model_checker(const scenario& sc) : sc_(sc), mask_(sc.capacity - 1) {}
+
+    /// @return Number of distinct states explored, 0 if a violation was found
+    size_t run() {
+        explore(state{});
+        return failed_ ? 0 : visited_.size();
+    }
+
+private:
+    const scenario& sc_;
+    const uint8_t mask_;
+    std::unordered_set<std::string> visited_;
+    std::vector<std::string> trace_;
+    bool failed_ = false;
+
+    void explore(const state& s) {
+        if (failed_ || !visited_.emplace(reinterpret_cast<const char*>(&s), sizeof(state)).second) {
+            return;
+        }
+        if (!check_invariants(s)) {
+            return;
+        }
+
+        const bool sender_done = s.s_op == sc_.sender.size();
+        const bool receiver_done = s.r_op == sc_.receiver.size();
+        if (sender_done && receiver_done) {
+            check_final(s);
+            return;
+        }
+
+        if (!sender_done) {
+            state next = s;
+            trace_.push_back("S" + std::to_string(s.s_pc));
+            step_sender(next);
+            explore(next);
+            trace_.pop_back();
+        }
+        if (!receiver_done) {
+            state next = s;
+            trace_.push_back("R" + std::to_string(s.r_pc));
+            step_receiver(next);
+            explore(next);
+            trace_.pop_back();
+        }
+    }
+
+    bool expect(bool cond, const char* what) {
+        if (!cond && !failed_) {
+            failed_ = true;
+            std::cerr << "violation: " << what << "\n  capacity " << int(sc_.capacity) << ", sender";
+            for (Op op : sc_.sender) std::cerr << " " << name(op);
+            std::cerr << ", receiver";
+            for (Op op : sc_.receiver) std::cerr << " " << name(op);
+            std::cerr << "\n  trace";
+            for (const std::string& step : trace_) std::cerr << " " << step;
+            std::cerr << std::endl;
+            CHECK(!"interleaving violates the protocol");
+        }
+        return cond;
+    }
+
+    static const char* name(Op op) {
+        switch (op) {
+            case Op::SEND: return "send";
+            case Op::CLOSE_SENDER: return "close";
+            case Op::RECEIVE: return "receive";
+            case Op::RECEIVE_N: return "receive_n";
+            default: return "close";
+        }
+    }
+
+    uint8_t next_index(uint8_t i) const { return (i + 1) & mask_; }
+
+    bool being_read(const state& s, uint8_t slot) const {
+        return s.readingCount != 0 && ((slot - s.readingFirst) & mask_) < s.readingCount;
+    }
+
+    uint8_t live_count(const state& s) const {
+        uint8_t count = 0;
+        for (uint8_t i = 0; i < sc_.capacity; ++i) count += s.live[i];
+        return count;
+    }
+
+    bool check_invariants(const state& s) {
+        // The overwriting sender stores rcvCursor_ too, it must never erase the closed bit
+        return expect(!s.r_closed || (s.rcvCursor & CLOSED), "closed bit of the receiver was lost");
+    }
+
+    /// @brief Values still in the ring are the newest ones, in order between the cursors, everything else was received or dropped once
+    void check_final(const state& s) {
+        const uint8_t rcv = s.rcvCursor & mask_;
+        const uint8_t send = s.sendCursor & mask_;
+        const uint8_t count = (send - rcv) & mask_;
+        if (!expect(live_count(s) == count, "slots outside the cursors are alive or slots between them are empty")) return;
+        if (!expect(s.s_sent == s.r_received + s.overwritten + count, "a value was lost or duplicated")) return;
+        for (uint8_t i = 0; i < count; ++i) {
+            const uint8_t slot = (rcv + i) & mask_;
+            if (!expect(s.live[slot] && s.value[slot] == s.s_sent - count + i + 1, "ring does not hold the newest values in order")) return;
+        }
+        expect(count == 0 || s.r_last < s.value[rcv], "a value older than a received one is still in the ring");
+    }
+
+    void end_sender_op(state& s) {
+        ++s.s_op;
+        s.s_pc = OP_BEGIN;
+    }
+
+    void end_receiver_op(state& s) {
+        ++s.r_op;
+        s.r_pc = OP_BEGIN;
+    }
+
+    void step_sender(state& s) {
+        switch (s.s_pc) {
+            case OP_BEGIN:
+                if (sc_.sender[s.s_op] == Op::CLOSE_SENDER) {
+                    s.sendCursor |= CLOSED;
+                    end_sender_op(s);
+                    return;
+                }
+                // sendCursor_ is written only by the sender, reading it is local
+                s.s_send = s.sendCursor & mask_;
+                s.s_next = next_index(s.s_send);
+                s.s_pc = s.s_next == s.s_rcvCache ? S_LOAD_RCV : S_WRITE_BEGIN;
+                return;
+            case S_LOAD_RCV: {
+                const uint8_t rcv = s.rcvCursor;
+                s.s_rcvCache = rcv & mask_;
+                if (rcv & CLOSED) {
+                    end_sender_op(s);
+                } else {
+                    s.s_pc = s.s_next == s.s_rcvCache ? S_EXCHANGE : S_WRITE_BEGIN;
+                }
+                return;
+            }
+            case S_EXCHANGE: {
+                const uint8_t occupied = s.oldestOccupied;
+                s.oldestOccupied = 1;
+                if (occupied) {
+                    end_sender_op(s); // SKIP_DUE_TO_OVERWRITE
+                } else {
+                    s.s_pc = S_LOAD_NEWEST;
+                }
+                return;
+            }
+            case S_LOAD_NEWEST: {
+                const uint8_t newest = s.rcvCursor;
+                if (newest & CLOSED) {
+                    s.s_pc = S_RELEASE_CLOSED;
+                } else if (s.s_rcvCache == newest) {
+                    s.s_newest = newest;
+                    s.s_pc = S_DROP_BEGIN;
+                } else {
+                    s.s_rcvCache = newest;
+                    s.s_pc = S_RELEASE;
+                }
+                return;
+            }
+            case S_RELEASE_CLOSED:
+                s.oldestOccupied = 0;
+                end_sender_op(s); // CHANNEL_CLOSED
+                return;
+            case S_DROP_BEGIN:
+                expect(s.live[s.s_newest], "sender drops an empty slot");
+                expect(!being_read(s, s.s_newest), "sender drops the slot being received");
+                s.writing = s.s_newest;
+                s.s_pc = S_DROP_END;
+                return;
+            case S_DROP_END:
+                s.live[s.s_newest] = 0;
+                s.writing = NONE;
+                ++s.overwritten;
+                s.s_pc = S_STORE_RCV;
+                return;
+            case S_STORE_RCV:
+                s.s_rcvCache = next_index(s.s_newest);
+                s.rcvCursor = s.s_rcvCache;
+                s.s_pc = S_RELEASE;
+                return;
+            case S_RELEASE:
+                s.oldestOccupied = 0;
+                s.s_pc = S_WRITE_BEGIN;
+                return;
+            case S_WRITE_BEGIN:
+                expect(!s.live[s.s_send], "sender constructs over a live value");
+                expect(!being_read(s, s.s_send), "sender writes the slot being received");
+                s.writing = s.s_send;
+                s.s_pc = S_WRITE_END;
+                return;
+            case S_WRITE_END:
+                s.live[s.s_send] = 1;
+                s.value[s.s_send] = s.s_sent + 1;
+                s.writing = NONE;
+                s.s_pc = S_PUBLISH;
+                return;
+            case S_PUBLISH:
+                s.sendCursor = s.s_next;
+                ++s.s_sent;
+                end_sender_op(s); // SUCCESS
+                return;
+        }
+    }
+
+    void step_receiver(state& s) {
+        switch (s.r_pc) {
+            case OP_BEGIN:
+                // Both the receive paths and close_receiver start by taking the flag
+                s.r_pc = sc_.receiver[s.r_op] == Op::CLOSE_RECEIVER ? C_EXCHANGE : R_EXCHANGE;
+                step_receiver(s);
+                return;
+            case R_EXCHANGE: {
+                const uint8_t occupied = s.oldestOccupied;
+                s.oldestOccupied = 1;
+                if (occupied) {
+                    end_receiver_op(s); // SKIP_DUE_TO_OVERWRITE, or 0 from try_receive_n
+                } else {
+                    s.r_pc = R_LOAD_RCV;
+                }
+                return;
+            }
+            case R_LOAD_RCV: {
+                s.r_rcv = s.rcvCursor & mask_;
+                if (s.r_rcv != s.r_position) {
+                    // drop_stale_cache, values were dropped since the last receive
+                    s.r_position = s.r_rcv;
+                    s.r_sendCache = s.r_rcv;
+                }
+                const uint8_t ready = (s.r_sendCache - s.r_rcv) & mask_;
+                const uint8_t max = sc_.receiver[s.r_op] == Op::RECEIVE_N ? RECEIVE_N_MAX : 1;
+                if (sc_.receiver[s.r_op] == Op::RECEIVE_N ? ready < max : ready == 0) {
+                    s.r_pc = R_LOAD_SEND;
+                } else {
+                    s.r_count = std::min(ready, max);
+                    s.r_pc = R_READ_BEGIN;
+                }
+                return;
+            }
+            case R_LOAD_SEND: {
+                const uint8_t send = s.sendCursor;
+                s.r_sendCache = send & mask_;
+                const uint8_t ready = (s.r_sendCache - s.r_rcv) & mask_;
+                const uint8_t max = sc_.receiver[s.r_op] == Op::RECEIVE_N ? RECEIVE_N_MAX : 1;
+                s.r_count = std::min(ready, max);
+                if (s.r_count != 0) {
+                    s.r_pc = R_READ_BEGIN;
+                    return;
+                }
+                if (send & CLOSED) {
+                    // SENDER_CLOSED, nothing can be sent or dropped anymore and everything was received
+                    expect(live_count(s) == 0 && s.s_sent == s.r_received + s.overwritten, "sender closed reported before the ring was drained");
+                }
+                s.r_pc = R_RELEASE; // CHANNEL_EMPTY or SENDER_CLOSED
+                return;
+            }
+            case R_READ_BEGIN:
+                for (uint8_t i = 0; i < s.r_count; ++i) {
+                    const uint8_t slot = (s.r_rcv + i) & mask_;
+                    expect(s.live[slot], "receiver reads an empty slot");
+                    expect(s.writing != slot, "receiver reads the slot being written");
+                    expect(s.value[slot] > s.r_last, "values received out of order or twice");
+                    s.r_last = s.value[slot];
+                }
+                s.readingFirst = s.r_rcv;
+                s.readingCount = s.r_count;
+                s.r_pc = R_READ_END;
+                return;
+            case R_READ_END:
+                for (uint8_t i = 0; i < s.r_count; ++i) {
+                    s.live[(s.r_rcv + i) & mask_] = 0;
+                }
+                s.readingFirst = NONE;
+                s.readingCount = 0;
+                s.r_received += s.r_count;
+                s.r_pc = R_ADVANCE;
+                return;
+            case R_ADVANCE:
+                s.rcvCursor = (s.r_rcv + s.r_count) & mask_;
+                s.r_position = s.rcvCursor;
+                s.r_pc = R_RELEASE;
+                return;
+            case R_RELEASE:
+                s.oldestOccupied = 0;
+                end_receiver_op(s);
+                return;
+            case C_EXCHANGE: {
+                const uint8_t occupied = s.oldestOccupied;
+                s.oldestOccupied = 1;
+                if (!occupied) {
+                    s.r_pc = C_CLOSE;
+                }
+                return; // spins while the sender holds the flag
+            }
+            case C_CLOSE:
+                s.rcvCursor |= CLOSED;
+                s.r_closed = 1;
+                s.r_pc = C_RELEASE;
+                return;
+            case C_RELEASE:
+                s.oldestOccupied = 0;
+                end_receiver_op(s);
+                return;
+        }
+    }
+};
+
+/// @brief Every receiver script of up to three receives, some followed by closing, against senders of up to capacity + 2 sends
+void overwrite_model() {
+    size_t scenarios = 0;
+    size_t states = 0;
+    for (uint8_t capacity : { uint8_t{2}, uint8_t{4} }) {
+        for (size_t sends = 1; sends <= size_t{capacity} + 2; ++sends) {
+            for (bool close_sender : { false, true }) {
+                for (size_t length = 0; length <= 3; ++length) {
+                    for (size_t pattern = 0; pattern < (size_t{1} << length); ++pattern) {
+                        for (bool close_receiver : { false, true }) {
+                            scenario sc{ capacity, std::vector<Op>(sends, Op::SEND), {} };
+                            if (close_sender) sc.sender.push_back(Op::CLOSE_SENDER);
+                            for (size_t i = 0; i < length; ++i) {
+                                sc.receiver.push_back((pattern >> i) & 1 ? Op::RECEIVE_N : Op::RECEIVE);
+                            }
+                            if (close_receiver) sc.receiver.push_back(Op::CLOSE_RECEIVER);
+
+                            const size_t explored = model_checker(sc).run();
+                            if (explored == 0) {
+                                return;
+                            }
+                            states += explored;
+                            ++scenarios;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    std::cout << "Explored " << states << " states in " << scenarios << " scenarios" << std::endl;
+}
+
+int main() {
+    test::run("oldestOccupied_ interleavings", overwrite_model);
+    return test::finish();
+}
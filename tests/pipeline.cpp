@@ -0,0 +1,130 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Pipeline Stress Tests
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <pipeline.hpp>
+#include <thread>
+#include <vector>
+#include <span>
+#include <atomic>
+#include <cstdint>
+#include "tools/check.hpp"
+
+using namespace channels;
+
+constexpr size_t ROUNDS = 40;
+constexpr uint64_t MESSAGES = 5000;
+
+/// @brief source -> map -> batch stage -> sink, every value arrives once and in order and wait() returns
+/// Small edges and batches keep the stages going idle and being notified all the time.
+void chain_stress() {
+    test::watchdog watchdog("chain_stress", std::chrono::seconds(60));
+    test::jitter jitter(0);
+    for (size_t round = 0; round < ROUNDS * test::scale(); ++round) {
+        pipeline::thread_pool pool(1 + jitter.below(4));
+        pipeline::graph graph(pool);
+
+        auto first = graph.make_edge<uint64_t>(size_t{1} << (1 + jitter.below(6)));
+        auto second = graph.make_edge<uint64_t>(size_t{1} << (1 + jitter.below(6)));
+        auto third = graph.make_edge<uint64_t>(size_t{1} << (1 + jitter.below(6)));
+        auto input = graph.make_source(first);
+
+        graph.stage(first, second, [](uint64_t& value) -> uint64_t {
+            return value * 2;
+        });
+
+        const size_t min_batch = 1 + jitter.below(8);
+        graph.stage(second, third, [](std::span<uint64_t> batch, std::vector<uint64_t>& out) {
+            for (uint64_t value : batch) {
+                out.push_back(value + 1);
+            }
+        }, { .min_batch = min_batch, .max_batch = min_batch + jitter.below(16) });
+
+        uint64_t expected = 0;
+        graph.sink(third, [&expected](uint64_t& value) {
+            CHECK(value == 2 * expected + 1);
+            ++expected;
+        });
+
+        graph.start();
+        test::jitter sender(round + 1);
+        for (uint64_t i = 0; i < MESSAGES; ++i) {
+            input.send(i);
+            sender();
+        }
+        input.close();
+        graph.wait();
+        CHECK(expected == MESSAGES);
+    }
+}
+
+/// @brief Two sources on their own threads merged through an mpsc edge into a batch sink
+void fan_in_stress() {
+    test::watchdog watchdog("fan_in_stress", std::chrono::seconds(60));
+    test::jitter jitter(1);
+    for (size_t round = 0; round < ROUNDS * test::scale(); ++round) {
+        pipeline::thread_pool pool(1 + jitter.below(4));
+        pipeline::graph graph(pool);
+
+        auto merged = graph.make_edge<uint64_t, pipeline::EdgeKind::MPSC>(size_t{1} << (1 + jitter.below(6)));
+        auto left = graph.make_source(merged);
+        auto right = graph.make_source(merged);
+
+        uint64_t count = 0;
+        uint64_t sum = 0;
+        graph.sink(merged, [&count, &sum](std::span<uint64_t> batch) {
+            for (uint64_t value : batch) {
+                sum += value;
+            }
+            count += batch.size();
+        }, { .min_batch = 1 + jitter.below(8), .max_batch = 32 });
+        graph.start();
+
+        std::thread producer([&, round]() {
+            test::jitter jitter(2 * round + 2);
+            for (uint64_t i = 0; i < MESSAGES; ++i) {
+                left.send(i);
+                jitter();
+            }
+            left.close();
+        });
+        test::jitter sender(2 * round + 3);
+        for (uint64_t i = 0; i < MESSAGES; ++i) {
+            right.send(MESSAGES + i);
+            sender();
+        }
+        right.close();
+        producer.join();
+
+        graph.wait();
+        CHECK(count == 2 * MESSAGES);
+        CHECK(sum == (2 * MESSAGES) * (2 * MESSAGES - 1) / 2);
+    }
+}
+
+int main() {
+    test::run("chain", chain_stress);
+    test::run("fan in", fan_in_stress);
+    return test::finish();
+}
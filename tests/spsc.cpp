@@ -0,0 +1,335 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * SPSC Channel Stress Tests
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <spsc.hpp>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include "tools/check.hpp"
+
+using namespace channels;
+using namespace channels::spsc;
+
+constexpr uint64_t MESSAGES = 20000;
+constexpr size_t ROUNDS = 4;
+
+/// @brief Value counting its live instances, every constructed tracked has to be destroyed exactly once
+struct tracked {
+    static inline std::atomic<int64_t> live{0};
+
+    uint64_t value = 0;
+
+    tracked() noexcept { live.fetch_add(1, std::memory_order_relaxed); }
+    tracked(uint64_t v) noexcept : value(v) { live.fetch_add(1, std::memory_order_relaxed); }
+    tracked(const tracked& other) noexcept : value(other.value) { live.fetch_add(1, std::memory_order_relaxed); }
+    tracked(tracked&& other) noexcept : value(other.value) { live.fetch_add(1, std::memory_order_relaxed); }
+    tracked& operator=(const tracked&) noexcept = default;
+    tracked& operator=(tracked&&) noexcept = default;
+    ~tracked() { live.fetch_sub(1, std::memory_order_relaxed); }
+};
+
+/// @brief Value checked for torn reads, the second word is always the complement of the first
+struct stamped {
+    uint64_t value = 0;
+    uint64_t check = ~uint64_t{0};
+
+    stamped() noexcept = default;
+    stamped(uint64_t v) noexcept : value(v), check(~v) {}
+};
+
+inline uint64_t value_of(uint64_t v) noexcept { return v; }
+inline uint64_t value_of(const tracked& v) noexcept { return v.value; }
+inline uint64_t value_of(const stamped& v) noexcept { return v.value; }
+
+/// @brief Every value is received exactly once and in order, sends and receives randomly mix single and batch calls
+template <typename T, WaitStrategy Wait, SlotLayout Layout>
+void fifo_stress() {
+    for (size_t round = 0; round < ROUNDS * test::scale(); ++round) {
+        test::jitter jitter(2 * round);
+        const size_t capacity = size_t{1} << (1 + jitter.below(8));
+        auto [sender, receiver] = channel<T, OverflowStrategy::WAIT_ON_FULL, Wait, std::allocator<T>, no_stats, Layout>(capacity);
+
+        std::thread producer([&, round, sender = std::move(sender)]() mutable {
+            test::jitter jitter(2 * round + 1);
+            std::vector<T> batch;
+            uint64_t next = 0;
+            while (next < MESSAGES) {
+                if (jitter.below(4) == 0) {
+                    batch.clear();
+                    const uint64_t n = std::min<uint64_t>(1 + jitter.below(32), MESSAGES - next);
+                    for (uint64_t i = 0; i < n; ++i) {
+                        batch.emplace_back(next + i);
+                    }
+                    CHECK(sender.send_n(batch.begin(), batch.end()) == n);
+                    next += n;
+                } else {
+                    CHECK(sender.send(T(next)) == ResponseStatus::SUCCESS);
+                    ++next;
+                }
+                jitter();
+            }
+            sender.close();
+        });
+
+        std::vector<T> batch(32);
+        uint64_t expected = 0;
+        bool open = true;
+        while (open) {
+            const size_t op = jitter.below(3);
+            if (op == 0) {
+                T value;
+                if (receiver.receive(value) == ResponseStatus::SUCCESS) {
+                    CHECK(value_of(value) == expected);
+                    ++expected;
+                } else {
+                    open = false;
+                }
+            } else {
+                const size_t n = 1 + jitter.below(batch.size());
+                const size_t count = op == 1 ? receiver.try_receive_n(batch.begin(), n) : receiver.receive_n(batch.begin(), n);
+                CHECK(count <= n);
+                for (size_t i = 0; i < count; ++i) {
+                    CHECK(value_of(batch[i]) == expected);
+                    ++expected;
+                }
+                if (count == 0) {
+                    // try_receive_n does not report closing, receive(T&) does once the ring is drained
+                    T value;
+                    const ResponseStatus status = receiver.try_receive(value);
+                    if (status == ResponseStatus::SUCCESS) {
+                        CHECK(value_of(value) == expected);
+                        ++expected;
+                    } else if (status == ResponseStatus::SENDER_CLOSED) {
+                        open = false;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+            jitter();
+        }
+
+        producer.join();
+        CHECK(expected == MESSAGES);
+    }
+    CHECK(tracked::live.load() == 0);
+}
+
+/// @brief Zero-copy reserve/commit and peek/release keep the same order as send and receive
+template <WaitStrategy Wait, SlotLayout Layout>
+void span_stress() {
+    for (size_t round = 0; round < ROUNDS * test::scale(); ++round) {
+        test::jitter jitter(2 * round);
+        const size_t capacity = size_t{1} << (1 + jitter.below(8));
+        auto [sender, receiver] = channel<uint64_t, OverflowStrategy::WAIT_ON_FULL, Wait, std::allocator<uint64_t>, no_stats, Layout>(capacity);
+
+        std::thread producer([&, round, sender = std::move(sender)]() mutable {
+            test::jitter jitter(2 * round + 1);
+            uint64_t next = 0;
+            while (next < MESSAGES) {
+                RingSpan<uint64_t> slots = sender.reserve(1 + jitter.below(32));
+                if (slots.empty()) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                const size_t n = std::min<uint64_t>(1 + jitter.below(slots.size()), MESSAGES - next);
+                for (size_t i = 0; i < n; ++i) {
+                    slots[i] = next + i;
+                }
+                sender.commit(n);
+                next += n;
+                jitter();
+            }
+            sender.close();
+        });
+
+        uint64_t expected = 0;
+        while (expected < MESSAGES) {
+            RingSpan<uint64_t> values = receiver.peek();
+            if (values.empty()) {
+                std::this_thread::yield();
+                continue;
+            }
+            const size_t n = 1 + jitter.below(values.size());
+            for (size_t i = 0; i < n; ++i) {
+                CHECK(values[i] == expected + i);
+            }
+            receiver.release(n);
+            expected += n;
+            jitter();
+        }
+
+        producer.join();
+        uint64_t value;
+        CHECK(receiver.try_receive(value) == ResponseStatus::SENDER_CLOSED);
+    }
+}
+
+/// @brief Closing the receiver wakes up a blocked sender, values sent before closing are destroyed with the channel
+template <WaitStrategy Wait>
+void close_stress() {
+    for (size_t round = 0; round < ROUNDS * test::scale(); ++round) {
+        test::jitter jitter(2 * round);
+        const size_t capacity = size_t{1} << (1 + jitter.below(6));
+        const uint64_t stop = jitter.below(MESSAGES / 10);
+        auto [sender, receiver] = channel<tracked, OverflowStrategy::WAIT_ON_FULL, Wait>(capacity);
+
+        std::thread producer([&, sender = std::move(sender)]() mutable {
+            uint64_t next = 0;
+            while (sender.send(tracked(next)) == ResponseStatus::SUCCESS) {
+                ++next;
+            }
+            CHECK(next >= stop);
+        });
+
+        tracked value;
+        for (uint64_t expected = 0; expected < stop; ++expected) {
+            CHECK(receiver.receive(value) == ResponseStatus::SUCCESS);
+            CHECK(value.value == expected);
+            jitter();
+        }
+        receiver.close();
+        producer.join();
+    }
+    CHECK(tracked::live.load() == 0);
+}
+
+/// @brief Overwritten values are dropped, never received twice or out of order, and the newest one always survives
+template <WaitStrategy Wait, SlotLayout Layout>
+void overwrite_stress() {
+    for (size_t round = 0; round < ROUNDS * test::scale(); ++round) {
+        test::jitter jitter(2 * round);
+        const size_t capacity = size_t{1} << (1 + jitter.below(5));
+        auto [sender, receiver] = channel<tracked, OverflowStrategy::OVERWRITE_ON_FULL, Wait, std::allocator<tracked>, no_stats, Layout>(capacity);
+
+        std::thread producer([&, round, sender = std::move(sender)]() mutable {
+            test::jitter jitter(2 * round + 1);
+            for (uint64_t next = 0; next < MESSAGES; ++next) {
+                // Skipped while the receiver holds the oldest slot, the value is retried
+                ResponseStatus status;
+                while ((status = sender.try_send(tracked(next))) == ResponseStatus::SKIP_DUE_TO_OVERWRITE) {
+                    std::this_thread::yield();
+                }
+                CHECK(status == ResponseStatus::SUCCESS);
+                jitter();
+            }
+            sender.close();
+        });
+
+        std::vector<tracked> batch(8);
+        uint64_t received = 0;
+        uint64_t last = 0;
+        for (;;) {
+            size_t count = 0;
+            ResponseStatus status = ResponseStatus::SUCCESS;
+            if (jitter.below(2) == 0) {
+                status = receiver.try_receive(batch[0]);
+                count = status == ResponseStatus::SUCCESS;
+            } else {
+                count = receiver.try_receive_n(batch.begin(), 1 + jitter.below(batch.size()));
+                if (count == 0) {
+                    status = receiver.try_receive(batch[0]);
+                    count = status == ResponseStatus::SUCCESS;
+                }
+            }
+            for (size_t i = 0; i < count; ++i) {
+                CHECK(received == 0 || batch[i].value > last);
+                last = batch[i].value;
+                ++received;
+            }
+            if (status == ResponseStatus::SENDER_CLOSED) {
+                break;
+            }
+            if (count == 0) {
+                std::this_thread::yield();
+            }
+            jitter();
+        }
+
+        producer.join();
+        CHECK(received > 0 && last == MESSAGES - 1);
+    }
+    CHECK(tracked::live.load() == 0);
+}
+
+/// @brief A lapped receiver skips ahead, it never sees a torn value, a value twice or values out of order
+void sequenced_stress() {
+    for (size_t round = 0; round < ROUNDS * test::scale(); ++round) {
+        test::jitter jitter(2 * round);
+        const size_t capacity = size_t{1} << (1 + jitter.below(5));
+        auto [sender, receiver] = channel<stamped, OverflowStrategy::OVERWRITE_SEQUENCED, WaitStrategy::YIELD>(capacity);
+
+        std::thread producer([&, round, sender = std::move(sender)]() mutable {
+            test::jitter jitter(2 * round + 1);
+            for (uint64_t next = 0; next < MESSAGES; ++next) {
+                CHECK(sender.try_send(stamped(next)) == ResponseStatus::SUCCESS);
+                jitter();
+            }
+            sender.close();
+        });
+
+        stamped value;
+        uint64_t received = 0;
+        uint64_t last = 0;
+        for (;;) {
+            const ResponseStatus status = receiver.try_receive(value);
+            if (status == ResponseStatus::SENDER_CLOSED) {
+                break;
+            }
+            if (status == ResponseStatus::SUCCESS) {
+                CHECK(value.check == ~value.value);
+                CHECK(received == 0 || value.value > last);
+                last = value.value;
+                ++received;
+            } else {
+                std::this_thread::yield();
+            }
+            jitter();
+        }
+
+        producer.join();
+        CHECK(received > 0 && last == MESSAGES - 1);
+    }
+}
+
+int main() {
+    test::run("fifo uint64_t YIELD PACKED", fifo_stress<uint64_t, WaitStrategy::YIELD, SlotLayout::PACKED>);
+    test::run("fifo uint64_t ATOMIC_WAIT PACKED", fifo_stress<uint64_t, WaitStrategy::ATOMIC_WAIT, SlotLayout::PACKED>);
+    test::run("fifo uint64_t ADAPTIVE PACKED", fifo_stress<uint64_t, WaitStrategy::ADAPTIVE, SlotLayout::PACKED>);
+    test::run("fifo uint64_t ADAPTIVE PADDED", fifo_stress<uint64_t, WaitStrategy::ADAPTIVE, SlotLayout::PADDED>);
+    test::run("fifo uint64_t ADAPTIVE LINE_RELEASE", fifo_stress<uint64_t, WaitStrategy::ADAPTIVE, SlotLayout::LINE_RELEASE>);
+    test::run("fifo tracked YIELD PACKED", fifo_stress<tracked, WaitStrategy::YIELD, SlotLayout::PACKED>);
+    test::run("fifo tracked ATOMIC_WAIT PADDED", fifo_stress<tracked, WaitStrategy::ATOMIC_WAIT, SlotLayout::PADDED>);
+    test::run("fifo tracked ADAPTIVE LINE_RELEASE", fifo_stress<tracked, WaitStrategy::ADAPTIVE, SlotLayout::LINE_RELEASE>);
+    test::run("reserve/peek YIELD PACKED", span_stress<WaitStrategy::YIELD, SlotLayout::PACKED>);
+    test::run("reserve/peek ADAPTIVE LINE_RELEASE", span_stress<WaitStrategy::ADAPTIVE, SlotLayout::LINE_RELEASE>);
+    test::run("close ATOMIC_WAIT", close_stress<WaitStrategy::ATOMIC_WAIT>);
+    test::run("close ADAPTIVE", close_stress<WaitStrategy::ADAPTIVE>);
+    test::run("overwrite YIELD PACKED", overwrite_stress<WaitStrategy::YIELD, SlotLayout::PACKED>);
+    test::run("overwrite YIELD PADDED", overwrite_stress<WaitStrategy::YIELD, SlotLayout::PADDED>);
+    test::run("overwrite sequenced", sequenced_stress);
+    return test::finish();
+}
@@ -0,0 +1,142 @@
+/*
+ * Channels-CPP - A high-performance lock-free channel library for C++
+ * Test Utilities
+ * 
+ * Copyright (c) 2025 Kacper Poneta (poneciak57)
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+
+/// @brief Marks the running test as failed and reports the failed condition, the test keeps running
+#define CHECK(cond) \
+    do { \
+        if (!(cond)) { \
+            test::report_failure(#cond, __FILE__, __LINE__); \
+        } \
+    } while (0)
+
+namespace test {
+
+inline int& failures() noexcept {
+    static int count = 0;
+    return count;
+}
+
+inline void report_failure(const char* cond, const char* file, int line) noexcept {
+    // Reporting only the first few keeps a broken stress loop readable
+    if (failures()++ < 8) {
+        std::cerr << file << ":" << line << ": CHECK(" << cond << ") failed" << std::endl;
+    }
+}
+
+/// @brief Seed of the randomized tests, TEST_SEED in the environment replays a failed run
+inline uint64_t seed() {
+    static const uint64_t value = [] {
+        const char* env = std::getenv("TEST_SEED");
+        return env ? std::strtoull(env, nullptr, 10) : std::random_device{}();
+    }();
+    return value;
+}
+
+/// @brief Scale of the stress loops, TEST_SCALE in the environment runs them for longer
+inline size_t scale() {
+    static const size_t value = [] {
+        const char* env = std::getenv("TEST_SCALE");
+        return env ? std::max<size_t>(1, std::strtoull(env, nullptr, 10)) : size_t{1};
+    }();
+    return value;
+}
+
+/// @brief Runs a named test case and prints its result
+template <typename F>
+void run(const char* name, F&& f) {
+    const int before = failures();
+    f();
+    std::cout << (failures() == before ? "[ OK ] " : "[FAIL] ") << name << std::endl;
+}
+
+/// @brief Prints the summary, the result is the exit code of the test binary
+inline int finish() {
+    if (failures() != 0) {
+        std::cout << failures() << " check(s) failed, seed " << seed() << std::endl;
+        return 1;
+    }
+    std::cout << "All tests passed, seed " << seed() << std::endl;
+    return 0;
+}
+
+/// @brief Aborts the test if it is still alive after the timeout, so a lost wakeup fails instead of hanging
+class watchdog {
+public:
+    watchdog(const char* what, std::chrono::seconds timeout) : thread_([this, what, timeout] {
+        std::unique_lock lock(mutex_);
+        if (!cv_.wait_for(lock, timeout * scale(), [this] { return done_; })) {
+            std::cerr << "watchdog: " << what << " did not finish, seed " << seed() << std::endl;
+            std::abort();
+        }
+    }) {}
+
+    ~watchdog() {
+        {
+            std::lock_guard lock(mutex_);
+            done_ = true;
+        }
+        cv_.notify_one();
+        thread_.join();
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool done_ = false;
+    std::thread thread_;
+};
+
+/// @brief Randomly yields to shake out interleavings, threads on a loaded machine rarely preempt each other otherwise
+class jitter {
+public:
+    explicit jitter(uint64_t stream) : rng_(seed() ^ (stream * 0x9e3779b97f4a7c15ull)) {}
+
+    inline void operator()() {
+        if ((rng_() & 15) == 0) {
+            std::this_thread::yield();
+        }
+    }
+
+    inline size_t below(size_t n) {
+        return std::uniform_int_distribution<size_t>(0, n - 1)(rng_);
+    }
+
+private:
+    std::mt19937_64 rng_;
+};
+
+}